@@ -35,7 +35,7 @@ namespace UnrealEngine.Framework {
 	// Automatically generated
 
 	internal static class Shared {
-		internal const int checksum = 0x2F0;
+		internal const int checksum = 0x33D;
 		internal static Dictionary<int, IntPtr> userFunctions = new();
 		private const string dynamicTypesAssemblyName = "UnrealEngine.DynamicTypes";
 		private static readonly ModuleBuilder moduleBuilder = AssemblyBuilder.DefineDynamicAssembly(new(dynamicTypesAssemblyName), AssemblyBuilderAccess.RunAndCollect).DefineDynamicModule(dynamicTypesAssemblyName);
@@ -195,7 +195,7 @@ namespace UnrealEngine.Framework {
 				int head = 0;
 				IntPtr* worldFunctions = (IntPtr*)buffer[position++];
 
-				World.forEachActor = (delegate* unmanaged[Cdecl]<ref ObjectReference*, ref int, void>)worldFunctions[head++];
+				World.getActors = (delegate* unmanaged[Cdecl]<ActorType, long*, ActorReference*, int, int>)worldFunctions[head++];
 				World.getActorCount = (delegate* unmanaged[Cdecl]<int>)worldFunctions[head++];
 				World.getDeltaSeconds = (delegate* unmanaged[Cdecl]<float>)worldFunctions[head++];
 				World.getRealTimeSeconds = (delegate* unmanaged[Cdecl]<float>)worldFunctions[head++];
@@ -205,6 +205,7 @@ namespace UnrealEngine.Framework {
 				World.getWorldOrigin = (delegate* unmanaged[Cdecl]<ref Vector3, void>)worldFunctions[head++];
 				World.getActor = (delegate* unmanaged[Cdecl]<byte[], ActorType, IntPtr>)worldFunctions[head++];
 				World.getActorByTag = (delegate* unmanaged[Cdecl]<byte[], ActorType, IntPtr>)worldFunctions[head++];
+				World.getActorsByTag = (delegate* unmanaged[Cdecl]<byte[], ActorType, ref ObjectReference*, ref int, void>)worldFunctions[head++];
 				World.getActorByID = (delegate* unmanaged[Cdecl]<uint, ActorType, IntPtr>)worldFunctions[head++];
 				World.getFirstPlayerController = (delegate* unmanaged[Cdecl]<IntPtr>)worldFunctions[head++];
 				World.getGameMode = (delegate* unmanaged[Cdecl]<IntPtr>)worldFunctions[head++];
@@ -222,6 +223,14 @@ namespace UnrealEngine.Framework {
 				World.setOnComponentEndCursorOverCallback = (delegate* unmanaged[Cdecl]<IntPtr, void>)worldFunctions[head++];
 				World.setOnComponentClickedCallback = (delegate* unmanaged[Cdecl]<IntPtr, void>)worldFunctions[head++];
 				World.setOnComponentReleasedCallback = (delegate* unmanaged[Cdecl]<IntPtr, void>)worldFunctions[head++];
+				World.setEventsBatching = (delegate* unmanaged[Cdecl]<IntPtr, void>)worldFunctions[head++];
+				World.setRunOnAnyThread = (delegate* unmanaged[Cdecl]<TickGroup, Bool, Bool>)worldFunctions[head++];
+				World.registerTickFunction = (delegate* unmanaged[Cdecl]<IntPtr, TickGroup, float, Bool, int>)worldFunctions[head++];
+				World.unregisterTickFunction = (delegate* unmanaged[Cdecl]<int, Bool>)worldFunctions[head++];
+				World.setTickFunctionEnabled = (delegate* unmanaged[Cdecl]<int, Bool, Bool>)worldFunctions[head++];
+				World.addTickPrerequisiteActor = (delegate* unmanaged[Cdecl]<int, IntPtr, Bool>)worldFunctions[head++];
+				World.addTickPrerequisiteComponent = (delegate* unmanaged[Cdecl]<int, IntPtr, Bool>)worldFunctions[head++];
+				World.setFixedTick = (delegate* unmanaged[Cdecl]<float, int, void>)worldFunctions[head++];
 				World.setSimulatePhysics = (delegate* unmanaged[Cdecl]<Bool, void>)worldFunctions[head++];
 				World.setGravity = (delegate* unmanaged[Cdecl]<float, void>)worldFunctions[head++];
 				World.setWorldOrigin = (delegate* unmanaged[Cdecl]<in Vector3, Bool>)worldFunctions[head++];
@@ -238,6 +247,94 @@ namespace UnrealEngine.Framework {
 				World.overlapAnyTestByProfile = (delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, byte[], in CollisionShape, IntPtr, IntPtr, Bool>)worldFunctions[head++];
 				World.overlapBlockingTestByChannel = (delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, CollisionChannel, in CollisionShape, IntPtr, IntPtr, Bool>)worldFunctions[head++];
 				World.overlapBlockingTestByProfile = (delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, byte[], in CollisionShape, IntPtr, IntPtr, Bool>)worldFunctions[head++];
+				World.lineTraceBatchByChannel = (delegate* unmanaged[Cdecl]<Vector3*, Vector3*, int, CollisionChannel, Hit*, byte*, Bool, IntPtr, IntPtr, int>)worldFunctions[head++];
+				World.sweepBatchByChannel = (delegate* unmanaged[Cdecl]<Vector3*, Vector3*, Quaternion*, int, CollisionChannel, in CollisionShape, Hit*, byte*, Bool, IntPtr, IntPtr, int>)worldFunctions[head++];
+				World.setOnAsyncQueriesCallback = (delegate* unmanaged[Cdecl]<IntPtr, void>)worldFunctions[head++];
+				World.asyncLineTraceByChannel = (delegate* unmanaged[Cdecl]<in Vector3, in Vector3, CollisionChannel, Bool, Bool, IntPtr, IntPtr, uint>)worldFunctions[head++];
+				World.asyncSweepByChannel = (delegate* unmanaged[Cdecl]<in Vector3, in Vector3, in Quaternion, CollisionChannel, in CollisionShape, Bool, Bool, IntPtr, IntPtr, uint>)worldFunctions[head++];
+				World.asyncOverlapByChannel = (delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, CollisionChannel, in CollisionShape, IntPtr, IntPtr, uint>)worldFunctions[head++];
+				World.lineTraceMultiByChannel = (delegate* unmanaged[Cdecl]<in Vector3, in Vector3, CollisionChannel, Hit*, int, Bool, IntPtr, IntPtr, int>)worldFunctions[head++];
+				World.lineTraceMultiByProfile = (delegate* unmanaged[Cdecl]<in Vector3, in Vector3, byte[], Hit*, int, Bool, IntPtr, IntPtr, int>)worldFunctions[head++];
+				World.sweepMultiByChannel = (delegate* unmanaged[Cdecl]<in Vector3, in Vector3, in Quaternion, CollisionChannel, in CollisionShape, Hit*, int, Bool, IntPtr, IntPtr, int>)worldFunctions[head++];
+				World.sweepMultiByProfile = (delegate* unmanaged[Cdecl]<in Vector3, in Vector3, in Quaternion, byte[], in CollisionShape, Hit*, int, Bool, IntPtr, IntPtr, int>)worldFunctions[head++];
+				World.overlapMultiByChannel = (delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, CollisionChannel, in CollisionShape, ComponentReference*, int, IntPtr, IntPtr, int>)worldFunctions[head++];
+				World.overlapMultiByProfile = (delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, byte[], in CollisionShape, ComponentReference*, int, IntPtr, IntPtr, int>)worldFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* jobsFunctions = (IntPtr*)buffer[position++];
+
+				Jobs.schedule = (delegate* unmanaged[Cdecl]<IntPtr, IntPtr, int*, int, int>)jobsFunctions[head++];
+				Jobs.scheduleParallel = (delegate* unmanaged[Cdecl]<IntPtr, IntPtr, int, int, int*, int, int>)jobsFunctions[head++];
+				Jobs.isCompleted = (delegate* unmanaged[Cdecl]<int, Bool>)jobsFunctions[head++];
+				Jobs.wait = (delegate* unmanaged[Cdecl]<int, void>)jobsFunctions[head++];
+				Jobs.release = (delegate* unmanaged[Cdecl]<int, void>)jobsFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* spatialHashFunctions = (IntPtr*)buffer[position++];
+
+				SpatialHash.setCellSize = (delegate* unmanaged[Cdecl]<float, void>)spatialHashFunctions[head++];
+				SpatialHash.add = (delegate* unmanaged[Cdecl]<IntPtr, Bool>)spatialHashFunctions[head++];
+				SpatialHash.remove = (delegate* unmanaged[Cdecl]<IntPtr, Bool>)spatialHashFunctions[head++];
+				SpatialHash.queryRadius = (delegate* unmanaged[Cdecl]<in Vector3, float, ActorReference*, int, int>)spatialHashFunctions[head++];
+				SpatialHash.queryBox = (delegate* unmanaged[Cdecl]<in Vector3, in Vector3, ActorReference*, int, int>)spatialHashFunctions[head++];
+				SpatialHash.queryKNearest = (delegate* unmanaged[Cdecl]<in Vector3, float, ActorReference*, int, int>)spatialHashFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* handlesFunctions = (IntPtr*)buffer[position++];
+
+				Handles.getTable = (delegate* unmanaged[Cdecl]<IntPtr>)handlesFunctions[head++];
+				Handles.acquire = (delegate* unmanaged[Cdecl]<IntPtr, ulong>)handlesFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* mirrorFunctions = (IntPtr*)buffer[position++];
+
+				Mirror.getTable = (delegate* unmanaged[Cdecl]<IntPtr>)mirrorFunctions[head++];
+				Mirror.add = (delegate* unmanaged[Cdecl]<IntPtr, int>)mirrorFunctions[head++];
+				Mirror.remove = (delegate* unmanaged[Cdecl]<IntPtr, Bool>)mirrorFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* actorPoolFunctions = (IntPtr*)buffer[position++];
+
+				ActorPool.acquire = (delegate* unmanaged[Cdecl]<ActorType, IntPtr, in Transform, IntPtr>)actorPoolFunctions[head++];
+				ActorPool.release = (delegate* unmanaged[Cdecl]<IntPtr, Bool>)actorPoolFunctions[head++];
+				ActorPool.prewarm = (delegate* unmanaged[Cdecl]<ActorType, IntPtr, int, void>)actorPoolFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* collisionQueryFunctions = (IntPtr*)buffer[position++];
+
+				CollisionQuery.create = (delegate* unmanaged[Cdecl]<CollisionChannel, byte[], Bool, int>)collisionQueryFunctions[head++];
+				CollisionQuery.destroy = (delegate* unmanaged[Cdecl]<int, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.addIgnoredActor = (delegate* unmanaged[Cdecl]<int, IntPtr, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.addIgnoredComponent = (delegate* unmanaged[Cdecl]<int, IntPtr, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.clearIgnored = (delegate* unmanaged[Cdecl]<int, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.addObjectType = (delegate* unmanaged[Cdecl]<int, CollisionChannel, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.setMobility = (delegate* unmanaged[Cdecl]<int, QueryMobility, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.setTraceComplex = (delegate* unmanaged[Cdecl]<int, Bool, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.lineTraceTest = (delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.lineTraceSingle = (delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, ref Hit, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.lineTraceMulti = (delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, Hit*, int, int>)collisionQueryFunctions[head++];
+				CollisionQuery.lineTraceBatch = (delegate* unmanaged[Cdecl]<int, Vector3*, Vector3*, int, Hit*, byte*, int>)collisionQueryFunctions[head++];
+				CollisionQuery.sweepTest = (delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, in Quaternion, in CollisionShape, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.sweepSingle = (delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, in Quaternion, in CollisionShape, ref Hit, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.sweepMulti = (delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, in Quaternion, in CollisionShape, Hit*, int, int>)collisionQueryFunctions[head++];
+				CollisionQuery.overlapAnyTest = (delegate* unmanaged[Cdecl]<int, in Vector3, in Quaternion, in CollisionShape, Bool>)collisionQueryFunctions[head++];
+				CollisionQuery.overlapMulti = (delegate* unmanaged[Cdecl]<int, in Vector3, in Quaternion, in CollisionShape, ComponentReference*, int, int>)collisionQueryFunctions[head++];
+				CollisionQuery.lineTraceMultiCompact = (delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, HitFields, byte*, int, int>)collisionQueryFunctions[head++];
+				CollisionQuery.lineTraceBatchCompact = (delegate* unmanaged[Cdecl]<int, Vector3*, Vector3*, int, HitFields, byte*, byte*, int>)collisionQueryFunctions[head++];
+				CollisionQuery.sweepMultiCompact = (delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, in Quaternion, in CollisionShape, HitFields, byte*, int, int>)collisionQueryFunctions[head++];
+				CollisionQuery.sweepBatchCompact = (delegate* unmanaged[Cdecl]<int, Vector3*, Vector3*, Quaternion*, int, in CollisionShape, HitFields, byte*, byte*, int>)collisionQueryFunctions[head++];
 			}
 
 			unchecked {
@@ -328,8 +425,12 @@ namespace UnrealEngine.Framework {
 				Actor.addTag = (delegate* unmanaged[Cdecl]<IntPtr, byte[], void>)actorFunctions[head++];
 				Actor.removeTag = (delegate* unmanaged[Cdecl]<IntPtr, byte[], void>)actorFunctions[head++];
 				Actor.hasTag = (delegate* unmanaged[Cdecl]<IntPtr, byte[], Bool>)actorFunctions[head++];
-				Actor.registerEvent = (delegate* unmanaged[Cdecl]<IntPtr, ActorEventType, void>)actorFunctions[head++];
+				Actor.registerEvent = (delegate* unmanaged[Cdecl]<IntPtr, ActorEventType, HitFilter, float, void>)actorFunctions[head++];
 				Actor.unregisterEvent = (delegate* unmanaged[Cdecl]<IntPtr, ActorEventType, void>)actorFunctions[head++];
+				Actor.spawnDeferred = (delegate* unmanaged[Cdecl]<byte[], ActorType, IntPtr, in Transform, IntPtr>)actorFunctions[head++];
+				Actor.finishSpawning = (delegate* unmanaged[Cdecl]<IntPtr, Bool>)actorFunctions[head++];
+				Actor.spawnBatch = (delegate* unmanaged[Cdecl]<ActorType, IntPtr, Transform*, int, Bool, ActorReference*, int>)actorFunctions[head++];
+				Actor.finishSpawningBatch = (delegate* unmanaged[Cdecl]<ActorReference*, int, int>)actorFunctions[head++];
 			}
 
 			unchecked {
@@ -659,6 +760,12 @@ namespace UnrealEngine.Framework {
 				SceneComponent.setWorldRotation = (delegate* unmanaged[Cdecl]<IntPtr, in Quaternion, void>)sceneComponentFunctions[head++];
 				SceneComponent.setWorldScale = (delegate* unmanaged[Cdecl]<IntPtr, in Vector3, void>)sceneComponentFunctions[head++];
 				SceneComponent.setWorldTransform = (delegate* unmanaged[Cdecl]<IntPtr, in Transform, void>)sceneComponentFunctions[head++];
+				SceneComponent.getComponentTransforms = (delegate* unmanaged[Cdecl]<IntPtr*, int, Transform*, void>)sceneComponentFunctions[head++];
+				SceneComponent.getComponentLocations = (delegate* unmanaged[Cdecl]<IntPtr*, int, Vector3*, void>)sceneComponentFunctions[head++];
+				SceneComponent.getComponentLocationsSeparated = (delegate* unmanaged[Cdecl]<IntPtr*, int, float*, float*, float*, void>)sceneComponentFunctions[head++];
+				SceneComponent.setWorldTransforms = (delegate* unmanaged[Cdecl]<IntPtr*, int, Transform*, Bool, void>)sceneComponentFunctions[head++];
+				SceneComponent.setWorldLocations = (delegate* unmanaged[Cdecl]<IntPtr*, int, Vector3*, Bool, void>)sceneComponentFunctions[head++];
+				SceneComponent.setRelativeTransforms = (delegate* unmanaged[Cdecl]<IntPtr*, int, Transform*, Bool, void>)sceneComponentFunctions[head++];
 			}
 
 			unchecked {
@@ -828,7 +935,7 @@ namespace UnrealEngine.Framework {
 				PrimitiveComponent.clearMoveIgnoreActors = (delegate* unmanaged[Cdecl]<IntPtr, void>)primitiveComponentFunctions[head++];
 				PrimitiveComponent.clearMoveIgnoreComponents = (delegate* unmanaged[Cdecl]<IntPtr, void>)primitiveComponentFunctions[head++];
 				PrimitiveComponent.createAndSetMaterialInstanceDynamic = (delegate* unmanaged[Cdecl]<IntPtr, int, IntPtr>)primitiveComponentFunctions[head++];
-				PrimitiveComponent.registerEvent = (delegate* unmanaged[Cdecl]<IntPtr, ComponentEventType, void>)primitiveComponentFunctions[head++];
+				PrimitiveComponent.registerEvent = (delegate* unmanaged[Cdecl]<IntPtr, ComponentEventType, HitFilter, float, void>)primitiveComponentFunctions[head++];
 				PrimitiveComponent.unregisterEvent = (delegate* unmanaged[Cdecl]<IntPtr, ComponentEventType, void>)primitiveComponentFunctions[head++];
 			}
 
@@ -1119,66 +1226,91 @@ namespace UnrealEngine.Framework {
 							if (method.IsPublic && method.IsStatic && !method.IsGenericMethod) {
 								ParameterInfo[] parameterInfos = method.GetParameters();
 
-								if (parameterInfos.Length <= 1) {
+								if (parameterInfos.Length <= 2) {
 									if (method.Name == "OnWorldBegin") {
-										if (parameterInfos.Length == 0)
-											events[0] = GetFunctionPointer(method);
-										else
+										if (parameterInfos.Length == 0) {
+											Events.onWorldBegin = method.CreateDelegate<Action>();
+											events[0] = (IntPtr)(delegate* unmanaged[Cdecl]<void>)&Events.OnWorldBegin;
+										} else {
 											throw new ArgumentException(method.Name + " should not have arguments");
+										}
 
 										continue;
 									}
 
 									if (method.Name == "OnWorldPostBegin") {
-										if (parameterInfos.Length == 0)
-											events[1] = GetFunctionPointer(method);
-										else
+										if (parameterInfos.Length == 0) {
+											Events.onWorldPostBegin = method.CreateDelegate<Action>();
+											events[1] = (IntPtr)(delegate* unmanaged[Cdecl]<void>)&Events.OnWorldPostBegin;
+										} else {
 											throw new ArgumentException(method.Name + " should not have arguments");
+										}
 
 										continue;
 									}
 
 									if (method.Name == "OnWorldPrePhysicsTick") {
-										if (parameterInfos.Length == 1 && parameterInfos[0].ParameterType == typeof(float))
-											events[2] = GetFunctionPointer(method);
-										else
+										if (parameterInfos.Length == 1 && parameterInfos[0].ParameterType == typeof(float)) {
+											Events.onWorldPrePhysicsTick = method.CreateDelegate<Action<float>>();
+											events[2] = (IntPtr)(delegate* unmanaged[Cdecl]<float, void>)&Events.OnWorldPrePhysicsTick;
+										} else {
 											throw new ArgumentException(method.Name + " should have a float argument");
+										}
 
 										continue;
 									}
 
 									if (method.Name == "OnWorldDuringPhysicsTick") {
-										if (parameterInfos.Length == 1 && parameterInfos[0].ParameterType == typeof(float))
-											events[3] = GetFunctionPointer(method);
-										else
+										if (parameterInfos.Length == 1 && parameterInfos[0].ParameterType == typeof(float)) {
+											Events.onWorldDuringPhysicsTick = method.CreateDelegate<Action<float>>();
+											events[3] = (IntPtr)(delegate* unmanaged[Cdecl]<float, void>)&Events.OnWorldDuringPhysicsTick;
+										} else {
 											throw new ArgumentException(method.Name + " should have a float argument");
+										}
 
 										continue;
 									}
 
 									if (method.Name == "OnWorldPostPhysicsTick") {
-										if (parameterInfos.Length == 1 && parameterInfos[0].ParameterType == typeof(float))
-											events[4] = GetFunctionPointer(method);
-										else
+										if (parameterInfos.Length == 1 && parameterInfos[0].ParameterType == typeof(float)) {
+											Events.onWorldPostPhysicsTick = method.CreateDelegate<Action<float>>();
+											events[4] = (IntPtr)(delegate* unmanaged[Cdecl]<float, void>)&Events.OnWorldPostPhysicsTick;
+										} else {
 											throw new ArgumentException(method.Name + " should have a float argument");
+										}
 
 										continue;
 									}
 
 									if (method.Name == "OnWorldPostUpdateTick") {
-										if (parameterInfos.Length == 1 && parameterInfos[0].ParameterType == typeof(float))
-											events[5] = GetFunctionPointer(method);
-										else
+										if (parameterInfos.Length == 1 && parameterInfos[0].ParameterType == typeof(float)) {
+											Events.onWorldPostUpdateTick = method.CreateDelegate<Action<float>>();
+											events[5] = (IntPtr)(delegate* unmanaged[Cdecl]<float, void>)&Events.OnWorldPostUpdateTick;
+										} else {
 											throw new ArgumentException(method.Name + " should have a float argument");
+										}
+
+										continue;
+									}
+
+									if (method.Name == "OnWorldFixedTick") {
+										if (parameterInfos.Length == 2 && parameterInfos[0].ParameterType == typeof(float) && parameterInfos[1].ParameterType == typeof(float)) {
+											Events.onWorldFixedTick = method.CreateDelegate<Action<float, float>>();
+											events[22] = (IntPtr)(delegate* unmanaged[Cdecl]<float, int, float, void>)&Events.OnWorldFixedTick;
+										} else {
+											throw new ArgumentException(method.Name + " should have two float arguments");
+										}
 
 										continue;
 									}
 
 									if (method.Name == "OnWorldEnd") {
-										if (parameterInfos.Length == 0)
-											events[6] = GetFunctionPointer(method);
-										else
+										if (parameterInfos.Length == 0) {
+											Events.onWorldEnd = method.CreateDelegate<Action>();
+											events[6] = (IntPtr)(delegate* unmanaged[Cdecl]<void>)&Events.OnWorldEnd;
+										} else {
 											throw new ArgumentException(method.Name + " should not have arguments");
+										}
 
 										continue;
 									}
@@ -1293,6 +1425,21 @@ namespace UnrealEngine.Framework {
 		private Bool startPenetrating;
 	}
 
+	[StructLayout(LayoutKind.Sequential)]
+	partial struct ActorState {
+		private Vector3 location;
+		private Quaternion rotation;
+		private Vector3 velocity;
+		private Bool hidden;
+		private Bool valid;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	partial struct AsyncQueryResult {
+		private uint ticket;
+		private Hit hit;
+	}
+
 	[StructLayout(LayoutKind.Explicit, Size = 28)]
 	partial struct Bounds {
 		[FieldOffset(0)]
@@ -1519,7 +1666,7 @@ namespace UnrealEngine.Framework {
 	}
 
 	static unsafe partial class World {
-		internal static delegate* unmanaged[Cdecl]<ref ObjectReference*, ref int, void> forEachActor;
+		internal static delegate* unmanaged[Cdecl]<ActorType, long*, ActorReference*, int, int> getActors;
 		internal static delegate* unmanaged[Cdecl]<int> getActorCount;
 		internal static delegate* unmanaged[Cdecl]<float> getDeltaSeconds;
 		internal static delegate* unmanaged[Cdecl]<float> getRealTimeSeconds;
@@ -1529,6 +1676,7 @@ namespace UnrealEngine.Framework {
 		internal static delegate* unmanaged[Cdecl]<ref Vector3, void> getWorldOrigin;
 		internal static delegate* unmanaged[Cdecl]<byte[], ActorType, IntPtr> getActor;
 		internal static delegate* unmanaged[Cdecl]<byte[], ActorType, IntPtr> getActorByTag;
+		internal static delegate* unmanaged[Cdecl]<byte[], ActorType, ref ObjectReference*, ref int, void> getActorsByTag;
 		internal static delegate* unmanaged[Cdecl]<uint, ActorType, IntPtr> getActorByID;
 		internal static delegate* unmanaged[Cdecl]<IntPtr> getFirstPlayerController;
 		internal static delegate* unmanaged[Cdecl]<IntPtr> getGameMode;
@@ -1546,6 +1694,14 @@ namespace UnrealEngine.Framework {
 		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setOnComponentEndCursorOverCallback;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setOnComponentClickedCallback;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setOnComponentReleasedCallback;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setEventsBatching;
+		internal static delegate* unmanaged[Cdecl]<TickGroup, Bool, Bool> setRunOnAnyThread;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, TickGroup, float, Bool, int> registerTickFunction;
+		internal static delegate* unmanaged[Cdecl]<int, Bool> unregisterTickFunction;
+		internal static delegate* unmanaged[Cdecl]<int, Bool, Bool> setTickFunctionEnabled;
+		internal static delegate* unmanaged[Cdecl]<int, IntPtr, Bool> addTickPrerequisiteActor;
+		internal static delegate* unmanaged[Cdecl]<int, IntPtr, Bool> addTickPrerequisiteComponent;
+		internal static delegate* unmanaged[Cdecl]<float, int, void> setFixedTick;
 		internal static delegate* unmanaged[Cdecl]<Bool, void> setSimulatePhysics;
 		internal static delegate* unmanaged[Cdecl]<float, void> setGravity;
 		internal static delegate* unmanaged[Cdecl]<in Vector3, Bool> setWorldOrigin;
@@ -1562,6 +1718,76 @@ namespace UnrealEngine.Framework {
 		internal static delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, byte[], in CollisionShape, IntPtr, IntPtr, Bool> overlapAnyTestByProfile;
 		internal static delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, CollisionChannel, in CollisionShape, IntPtr, IntPtr, Bool> overlapBlockingTestByChannel;
 		internal static delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, byte[], in CollisionShape, IntPtr, IntPtr, Bool> overlapBlockingTestByProfile;
+		internal static delegate* unmanaged[Cdecl]<Vector3*, Vector3*, int, CollisionChannel, Hit*, byte*, Bool, IntPtr, IntPtr, int> lineTraceBatchByChannel;
+		internal static delegate* unmanaged[Cdecl]<Vector3*, Vector3*, Quaternion*, int, CollisionChannel, in CollisionShape, Hit*, byte*, Bool, IntPtr, IntPtr, int> sweepBatchByChannel;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setOnAsyncQueriesCallback;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Vector3, CollisionChannel, Bool, Bool, IntPtr, IntPtr, uint> asyncLineTraceByChannel;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Vector3, in Quaternion, CollisionChannel, in CollisionShape, Bool, Bool, IntPtr, IntPtr, uint> asyncSweepByChannel;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, CollisionChannel, in CollisionShape, IntPtr, IntPtr, uint> asyncOverlapByChannel;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Vector3, CollisionChannel, Hit*, int, Bool, IntPtr, IntPtr, int> lineTraceMultiByChannel;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Vector3, byte[], Hit*, int, Bool, IntPtr, IntPtr, int> lineTraceMultiByProfile;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Vector3, in Quaternion, CollisionChannel, in CollisionShape, Hit*, int, Bool, IntPtr, IntPtr, int> sweepMultiByChannel;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Vector3, in Quaternion, byte[], in CollisionShape, Hit*, int, Bool, IntPtr, IntPtr, int> sweepMultiByProfile;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, CollisionChannel, in CollisionShape, ComponentReference*, int, IntPtr, IntPtr, int> overlapMultiByChannel;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Quaternion, byte[], in CollisionShape, ComponentReference*, int, IntPtr, IntPtr, int> overlapMultiByProfile;
+	}
+
+	static unsafe partial class Jobs {
+		internal static delegate* unmanaged[Cdecl]<IntPtr, IntPtr, int*, int, int> schedule;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, IntPtr, int, int, int*, int, int> scheduleParallel;
+		internal static delegate* unmanaged[Cdecl]<int, Bool> isCompleted;
+		internal static delegate* unmanaged[Cdecl]<int, void> wait;
+		internal static delegate* unmanaged[Cdecl]<int, void> release;
+	}
+
+	static unsafe partial class SpatialHash {
+		internal static delegate* unmanaged[Cdecl]<float, void> setCellSize;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, Bool> add;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, Bool> remove;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, float, ActorReference*, int, int> queryRadius;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, in Vector3, ActorReference*, int, int> queryBox;
+		internal static delegate* unmanaged[Cdecl]<in Vector3, float, ActorReference*, int, int> queryKNearest;
+	}
+
+	static unsafe partial class Handles {
+		internal static delegate* unmanaged[Cdecl]<IntPtr> getTable;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, ulong> acquire;
+	}
+
+	static unsafe partial class Mirror {
+		internal static delegate* unmanaged[Cdecl]<IntPtr> getTable;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, int> add;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, Bool> remove;
+	}
+
+	static unsafe partial class ActorPool {
+		internal static delegate* unmanaged[Cdecl]<ActorType, IntPtr, in Transform, IntPtr> acquire;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, Bool> release;
+		internal static delegate* unmanaged[Cdecl]<ActorType, IntPtr, int, void> prewarm;
+	}
+
+	static unsafe partial class CollisionQuery {
+		internal static delegate* unmanaged[Cdecl]<CollisionChannel, byte[], Bool, int> create;
+		internal static delegate* unmanaged[Cdecl]<int, Bool> destroy;
+		internal static delegate* unmanaged[Cdecl]<int, IntPtr, Bool> addIgnoredActor;
+		internal static delegate* unmanaged[Cdecl]<int, IntPtr, Bool> addIgnoredComponent;
+		internal static delegate* unmanaged[Cdecl]<int, Bool> clearIgnored;
+		internal static delegate* unmanaged[Cdecl]<int, CollisionChannel, Bool> addObjectType;
+		internal static delegate* unmanaged[Cdecl]<int, QueryMobility, Bool> setMobility;
+		internal static delegate* unmanaged[Cdecl]<int, Bool, Bool> setTraceComplex;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, Bool> lineTraceTest;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, ref Hit, Bool> lineTraceSingle;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, Hit*, int, int> lineTraceMulti;
+		internal static delegate* unmanaged[Cdecl]<int, Vector3*, Vector3*, int, Hit*, byte*, int> lineTraceBatch;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, in Quaternion, in CollisionShape, Bool> sweepTest;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, in Quaternion, in CollisionShape, ref Hit, Bool> sweepSingle;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, in Quaternion, in CollisionShape, Hit*, int, int> sweepMulti;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Quaternion, in CollisionShape, Bool> overlapAnyTest;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Quaternion, in CollisionShape, ComponentReference*, int, int> overlapMulti;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, HitFields, byte*, int, int> lineTraceMultiCompact;
+		internal static delegate* unmanaged[Cdecl]<int, Vector3*, Vector3*, int, HitFields, byte*, byte*, int> lineTraceBatchCompact;
+		internal static delegate* unmanaged[Cdecl]<int, in Vector3, in Vector3, in Quaternion, in CollisionShape, HitFields, byte*, int, int> sweepMultiCompact;
+		internal static delegate* unmanaged[Cdecl]<int, Vector3*, Vector3*, Quaternion*, int, in CollisionShape, HitFields, byte*, byte*, int> sweepBatchCompact;
 	}
 
 	unsafe partial struct Asset {
@@ -1634,8 +1860,12 @@ namespace UnrealEngine.Framework {
 		internal static delegate* unmanaged[Cdecl]<IntPtr, byte[], void> addTag;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, byte[], void> removeTag;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, byte[], Bool> hasTag;
-		internal static delegate* unmanaged[Cdecl]<IntPtr, ActorEventType, void> registerEvent;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, ActorEventType, HitFilter, float, void> registerEvent;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, ActorEventType, void> unregisterEvent;
+		internal static delegate* unmanaged[Cdecl]<byte[], ActorType, IntPtr, in Transform, IntPtr> spawnDeferred;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, Bool> finishSpawning;
+		internal static delegate* unmanaged[Cdecl]<ActorType, IntPtr, Transform*, int, Bool, ActorReference*, int> spawnBatch;
+		internal static delegate* unmanaged[Cdecl]<ActorReference*, int, int> finishSpawningBatch;
 	}
 
 	unsafe partial class GameModeBase {
@@ -1947,6 +2177,12 @@ namespace UnrealEngine.Framework {
 		internal static delegate* unmanaged[Cdecl]<IntPtr, in Quaternion, void> setWorldRotation;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, in Vector3, void> setWorldScale;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, in Transform, void> setWorldTransform;
+		internal static delegate* unmanaged[Cdecl]<IntPtr*, int, Transform*, void> getComponentTransforms;
+		internal static delegate* unmanaged[Cdecl]<IntPtr*, int, Vector3*, void> getComponentLocations;
+		internal static delegate* unmanaged[Cdecl]<IntPtr*, int, float*, float*, float*, void> getComponentLocationsSeparated;
+		internal static delegate* unmanaged[Cdecl]<IntPtr*, int, Transform*, Bool, void> setWorldTransforms;
+		internal static delegate* unmanaged[Cdecl]<IntPtr*, int, Vector3*, Bool, void> setWorldLocations;
+		internal static delegate* unmanaged[Cdecl]<IntPtr*, int, Transform*, Bool, void> setRelativeTransforms;
 	}
 
 	unsafe partial class AudioComponent {
@@ -2098,7 +2334,7 @@ namespace UnrealEngine.Framework {
 		internal static delegate* unmanaged[Cdecl]<IntPtr, void> clearMoveIgnoreActors;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, void> clearMoveIgnoreComponents;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, int, IntPtr> createAndSetMaterialInstanceDynamic;
-		internal static delegate* unmanaged[Cdecl]<IntPtr, ComponentEventType, void> registerEvent;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, ComponentEventType, HitFilter, float, void> registerEvent;
 		internal static delegate* unmanaged[Cdecl]<IntPtr, ComponentEventType, void> unregisterEvent;
 	}
 
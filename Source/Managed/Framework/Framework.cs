@@ -33,6 +33,7 @@ using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using System.Runtime.Serialization;
 using System.Text;
+using System.Threading;
 
 namespace UnrealEngine.Framework {
 	// Internal
@@ -40,6 +41,8 @@ namespace UnrealEngine.Framework {
 	internal static class ArrayPool {
 		[ThreadStatic]
 		private static byte[] stringBuffer;
+		[ThreadStatic]
+		private static IntPtr[] pointerBuffer;
 
 		public static byte[] GetStringBuffer() {
 			if (stringBuffer == null)
@@ -47,6 +50,13 @@ namespace UnrealEngine.Framework {
 
 			return stringBuffer;
 		}
+
+		public static IntPtr[] GetPointerBuffer(int length) {
+			if (pointerBuffer == null || pointerBuffer.Length < length)
+				pointerBuffer = GC.AllocateUninitializedArray<IntPtr>(Math.Max(length, 256), pinned: true);
+
+			return pointerBuffer;
+		}
 	}
 
 	internal static class Collector {
@@ -63,6 +73,392 @@ namespace UnrealEngine.Framework {
 		}
 	}
 
+	// Generation-checked handles of actors that are validated by reading the table shared with the engine
+	internal static unsafe partial class Handles {
+		private const int chunkShift = 12;
+		private const int chunkMask = (1 << chunkShift) - 1;
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Table {
+			internal uint** chunks;
+			internal int length;
+		}
+
+		private static Table* table;
+
+		public static ulong Acquire(IntPtr pointer) => acquire(pointer);
+
+		public static bool IsAlive(ulong handle) {
+			if (table == null)
+				table = (Table*)getTable();
+
+			uint index = (uint)handle;
+
+			// Chunks are never moved by the engine, so the table can be read from any thread
+			return index < (uint)Volatile.Read(ref table->length) && table->chunks[index >> chunkShift][index & chunkMask] == (uint)(handle >> 32);
+		}
+	}
+
+	// Typed entry points of the shared events that are called by the engine directly
+	internal static unsafe class Events {
+		// Indices of the shared events
+		private const int onActorBeginOverlapEvent = 7;
+		private const int onActorEndOverlapEvent = 8;
+		private const int onActorHitEvent = 9;
+		private const int onActorBeginCursorOverEvent = 10;
+		private const int onActorEndCursorOverEvent = 11;
+		private const int onComponentBeginOverlapEvent = 14;
+		private const int onComponentEndOverlapEvent = 15;
+		private const int onComponentHitEvent = 16;
+		private const int onComponentBeginCursorOverEvent = 17;
+		private const int onComponentEndCursorOverEvent = 18;
+
+		internal static Action onWorldBegin;
+		internal static Action onWorldPostBegin;
+		internal static Action<float> onWorldPrePhysicsTick;
+		internal static Action<float> onWorldDuringPhysicsTick;
+		internal static Action<float> onWorldPostPhysicsTick;
+		internal static Action<float> onWorldPostUpdateTick;
+		internal static Action<float, float> onWorldFixedTick;
+		internal static Action onWorldEnd;
+		internal static ActorOverlapDelegate onActorBeginOverlap;
+		internal static ActorOverlapDelegate onActorEndOverlap;
+		internal static ActorHitDelegate onActorHit;
+		internal static ActorCursorDelegate onActorBeginCursorOver;
+		internal static ActorCursorDelegate onActorEndCursorOver;
+		internal static ActorKeyDelegate onActorClicked;
+		internal static ActorKeyDelegate onActorReleased;
+		internal static ComponentOverlapDelegate onComponentBeginOverlap;
+		internal static ComponentOverlapDelegate onComponentEndOverlap;
+		internal static ComponentHitDelegate onComponentHit;
+		internal static ComponentCursorDelegate onComponentBeginCursorOver;
+		internal static ComponentCursorDelegate onComponentEndCursorOver;
+		internal static ComponentKeyDelegate onComponentClicked;
+		internal static ComponentKeyDelegate onComponentReleased;
+		internal static AsyncQueriesDelegate onAsyncQueries;
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnWorldBegin() {
+			try {
+				onWorldBegin();
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnWorldPostBegin() {
+			try {
+				onWorldPostBegin();
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnWorldPrePhysicsTick(float deltaTime) {
+			try {
+				onWorldPrePhysicsTick(deltaTime);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnWorldDuringPhysicsTick(float deltaTime) {
+			try {
+				onWorldDuringPhysicsTick(deltaTime);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnWorldPostPhysicsTick(float deltaTime) {
+			try {
+				onWorldPostPhysicsTick(deltaTime);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnWorldPostUpdateTick(float deltaTime) {
+			try {
+				onWorldPostUpdateTick(deltaTime);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnWorldFixedTick(float stepTime, int substeps, float alpha) {
+			// The interpolation alpha only applies after the last step of the frame
+			for (int i = 0; i < substeps; i++) {
+				try {
+					onWorldFixedTick(stepTime, i == substeps - 1 ? alpha : 0.0f);
+				}
+
+				catch (Exception exception) {
+					Report(exception);
+				}
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnWorldEnd() {
+			try {
+				onWorldEnd();
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnActorBeginOverlap(ActorReference overlapActor, ActorReference otherActor) {
+			try {
+				onActorBeginOverlap(overlapActor, otherActor);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnActorEndOverlap(ActorReference overlapActor, ActorReference otherActor) {
+			try {
+				onActorEndOverlap(overlapActor, otherActor);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnActorHit(ActorReference hitActor, ActorReference otherActor, Vector3* normalImpulse, Hit* hit) {
+			try {
+				onActorHit(hitActor, otherActor, *normalImpulse, *hit);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnActorBeginCursorOver(ActorReference actor) {
+			try {
+				onActorBeginCursorOver(actor);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnActorEndCursorOver(ActorReference actor) {
+			try {
+				onActorEndCursorOver(actor);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnActorClicked(ActorReference actor, IntPtr key) {
+			try {
+				onActorClicked(actor, Marshal.PtrToStringAnsi(key));
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnActorReleased(ActorReference actor, IntPtr key) {
+			try {
+				onActorReleased(actor, Marshal.PtrToStringAnsi(key));
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnComponentBeginOverlap(ComponentReference overlapComponent, ComponentReference otherComponent) {
+			try {
+				onComponentBeginOverlap(overlapComponent, otherComponent);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnComponentEndOverlap(ComponentReference overlapComponent, ComponentReference otherComponent) {
+			try {
+				onComponentEndOverlap(overlapComponent, otherComponent);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnComponentHit(ComponentReference hitComponent, ComponentReference otherComponent, Vector3* normalImpulse, Hit* hit) {
+			try {
+				onComponentHit(hitComponent, otherComponent, *normalImpulse, *hit);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnComponentBeginCursorOver(ComponentReference component) {
+			try {
+				onComponentBeginCursorOver(component);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnComponentEndCursorOver(ComponentReference component) {
+			try {
+				onComponentEndCursorOver(component);
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnComponentClicked(ComponentReference component, IntPtr key) {
+			try {
+				onComponentClicked(component, Marshal.PtrToStringAnsi(key));
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnComponentReleased(ComponentReference component, IntPtr key) {
+			try {
+				onComponentReleased(component, Marshal.PtrToStringAnsi(key));
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnEventsBatch(int* types, IntPtr* firstObjects, IntPtr* secondObjects, int* hitIndices, Vector3* normalImpulses, Hit* hits, int count) {
+			ActorReference* firstActors = (ActorReference*)firstObjects;
+			ActorReference* secondActors = (ActorReference*)secondObjects;
+			ComponentReference* firstComponents = (ComponentReference*)firstObjects;
+			ComponentReference* secondComponents = (ComponentReference*)secondObjects;
+
+			for (int i = 0; i < count; i++) {
+				try {
+					switch (types[i]) {
+						case onActorBeginOverlapEvent:
+							onActorBeginOverlap(firstActors[i], secondActors[i]);
+							break;
+
+						case onActorEndOverlapEvent:
+							onActorEndOverlap(firstActors[i], secondActors[i]);
+							break;
+
+						case onActorHitEvent:
+							onActorHit(firstActors[i], secondActors[i], normalImpulses[hitIndices[i]], hits[hitIndices[i]]);
+							break;
+
+						case onActorBeginCursorOverEvent:
+							onActorBeginCursorOver(firstActors[i]);
+							break;
+
+						case onActorEndCursorOverEvent:
+							onActorEndCursorOver(firstActors[i]);
+							break;
+
+						case onComponentBeginOverlapEvent:
+							onComponentBeginOverlap(firstComponents[i], secondComponents[i]);
+							break;
+
+						case onComponentEndOverlapEvent:
+							onComponentEndOverlap(firstComponents[i], secondComponents[i]);
+							break;
+
+						case onComponentHitEvent:
+							onComponentHit(firstComponents[i], secondComponents[i], normalImpulses[hitIndices[i]], hits[hitIndices[i]]);
+							break;
+
+						case onComponentBeginCursorOverEvent:
+							onComponentBeginCursorOver(firstComponents[i]);
+							break;
+
+						case onComponentEndCursorOverEvent:
+							onComponentEndCursorOver(firstComponents[i]);
+							break;
+					}
+				}
+
+				catch (Exception exception) {
+					Report(exception);
+				}
+			}
+		}
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		internal static void OnAsyncQueries(AsyncQueryResult* results, int count) {
+			try {
+				onAsyncQueries(new(results, count));
+			}
+
+			catch (Exception exception) {
+				Report(exception);
+			}
+		}
+
+		internal static void Report(Exception exception) {
+			byte[] message = exception.ToString().StringToBytes();
+
+			Debug.log(LogLevel.Error, message);
+			Debug.exception(message);
+		}
+	}
+
 	internal static class Extensions {
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
 		internal static T GetOrAdd<S, T>(this IDictionary<S, T> dictionary, S key, Func<T> valueCreator) => dictionary.TryGetValue(key, out var value) ? value : dictionary[key] = valueCreator();
@@ -330,6 +726,121 @@ namespace UnrealEngine.Framework {
 		OnComponentReleased
 	}
 
+	/// <summary>
+	/// Defines how hit events of the same colliding pair are filtered before dispatching
+	/// </summary>
+	public enum HitFilter : int {
+		/// <summary>
+		/// Every hit is dispatched
+		/// </summary>
+		None,
+		/// <summary>
+		/// Only the first hit is dispatched while the pair stays in contact
+		/// </summary>
+		FirstContact,
+		/// <summary>
+		/// Hits are dispatched at most at the specified rate per second while the pair stays in contact
+		/// </summary>
+		Rate,
+		/// <summary>
+		/// Only hits with the normal impulse greater than the specified threshold are dispatched
+		/// </summary>
+		Impulse
+	}
+
+	/// <summary>
+	/// Defines fields of the hit that are written to a compact buffer, fields are laid out in the order of their flags
+	/// </summary>
+	[Flags]
+	public enum HitFields : int {
+		/// <summary>
+		/// No fields
+		/// </summary>
+		None = 0,
+		/// <summary>
+		/// The actor hit by the trace
+		/// </summary>
+		Actor = 1 << 0,
+		/// <summary>
+		/// The component hit by the trace
+		/// </summary>
+		Component = 1 << 1,
+		/// <summary>
+		/// The location in world space where the moving shape would end up against the impacted object
+		/// </summary>
+		Location = 1 << 2,
+		/// <summary>
+		/// The location in world space of the actual contact of the trace shape with the impacted object
+		/// </summary>
+		ImpactLocation = 1 << 3,
+		/// <summary>
+		/// The normal of the hit in world space for the object that was swept
+		/// </summary>
+		Normal = 1 << 4,
+		/// <summary>
+		/// The normal of the hit in world space for the object that was hit by the sweep
+		/// </summary>
+		ImpactNormal = 1 << 5,
+		/// <summary>
+		/// The time from trace start to trace end
+		/// </summary>
+		Time = 1 << 6,
+		/// <summary>
+		/// The distance from trace start to hit location in world space
+		/// </summary>
+		Distance = 1 << 7,
+		/// <summary>
+		/// The distance along the normal that will result in moving out of penetration
+		/// </summary>
+		PenetrationDepth = 1 << 8,
+		/// <summary>
+		/// The index of the bone that was hit on the skinned mesh, -1 if no bone was hit
+		/// </summary>
+		BoneIndex = 1 << 9,
+		/// <summary>
+		/// Whether the hit was a blocking hit and whether the trace started in penetration
+		/// </summary>
+		Flags = 1 << 10
+	}
+
+	/// <summary>
+	/// Defines the tick group
+	/// </summary>
+	public enum TickGroup : int {
+		/// <summary>
+		/// Any item that needs to be executed before physics simulation starts
+		/// </summary>
+		PrePhysics,
+		/// <summary>
+		/// Special tick group that starts physics simulation
+		/// </summary>
+		StartPhysics,
+		/// <summary>
+		/// Any item that can be run in parallel with physics simulation
+		/// </summary>
+		DuringPhysics,
+		/// <summary>
+		/// Special tick group that ends physics simulation
+		/// </summary>
+		EndPhysics,
+		/// <summary>
+		/// Any item that needs rigid body and cloth simulation to be completed before being executed
+		/// </summary>
+		PostPhysics,
+		/// <summary>
+		/// Any item that needs the update work to be done before being ticked
+		/// </summary>
+		PostUpdateWork,
+		/// <summary>
+		/// Catchall for anything demoted to the end
+		/// </summary>
+		LastDemotable,
+		/// <summary>
+		/// Special tick group that is not actually a tick group, after every tick group this is repeatedly re-run until there are no more newly spawned items to run
+		/// </summary>
+		NewlySpawned
+	}
+
 	/// <summary>
 	/// Defines the animation mode
 	/// </summary>
@@ -904,6 +1415,24 @@ namespace UnrealEngine.Framework {
 		R8 = 71
 	}
 
+	/// <summary>
+	/// Defines the mobility of objects that collision queries consider
+	/// </summary>
+	public enum QueryMobility : int {
+		/// <summary>
+		/// Any object
+		/// </summary>
+		Any,
+		/// <summary>
+		/// Only static objects
+		/// </summary>
+		Static,
+		/// <summary>
+		/// Only movable and stationary objects
+		/// </summary>
+		Dynamic
+	}
+
 	/// <summary>
 	/// A representation of the engine's object reference
 	/// </summary>
@@ -1694,74 +2223,328 @@ namespace UnrealEngine.Framework {
 	}
 
 	/// <summary>
-	/// A combined axis-aligned bounding box and bounding sphere with the same origin
-	/// </summary>
-	public partial struct Bounds : IEquatable<Bounds> {
-		/// <summary>
-		/// Returns the origin of the bounding box and sphere
-		/// </summary>
-		public Vector3 Origin => origin;
+	/// A read-only view of trace hits written to a compact buffer with only the requested fields
+	/// </summary>
+	public readonly ref struct CompactHits {
+		private static readonly int[] fieldSizes = {
+			IntPtr.Size,
+			IntPtr.Size,
+			Unsafe.SizeOf<Vector3>(),
+			Unsafe.SizeOf<Vector3>(),
+			Unsafe.SizeOf<Vector3>(),
+			Unsafe.SizeOf<Vector3>(),
+			sizeof(float),
+			sizeof(float),
+			sizeof(float),
+			sizeof(int),
+			sizeof(int)
+		};
 
-		/// <summary>
-		/// Returns the extent of the bounding box
-		/// </summary>
-		public Vector3 BoxExtent => boxExtent;
+		private readonly ReadOnlySpan<byte> buffer;
+		private readonly HitFields fields;
+		private readonly int stride;
 
 		/// <summary>
-		/// Returns the radius of the bounding sphere
+		/// Initializes a new instance of the view over the buffer with the fields that were requested on the query
 		/// </summary>
-		public float SphereRadius => sphereRadius;
+		public CompactHits(ReadOnlySpan<byte> buffer, HitFields fields) {
+			this.buffer = buffer;
+			this.fields = fields;
+			stride = GetStride(fields);
+		}
 
 		/// <summary>
-		/// Tests for equality between two objects
+		/// Returns the fields of the hits
 		/// </summary>
-		public static bool operator ==(Bounds left, Bounds right) => left.Equals(right);
+		public HitFields Fields => fields;
 
 		/// <summary>
-		/// Tests for inequality between two objects
+		/// Returns the size of a single hit in bytes
 		/// </summary>
-		public static bool operator !=(Bounds left, Bounds right) => !left.Equals(right);
+		public int Stride => stride;
 
 		/// <summary>
-		/// Indicates equality of objects
+		/// Returns the number of hits that fit into the buffer
 		/// </summary>
-		public bool Equals(Bounds other) => origin == other.origin && boxExtent == other.boxExtent && sphereRadius == other.sphereRadius;
+		public int Length => stride > 0 ? buffer.Length / stride : 0;
 
 		/// <summary>
-		/// Indicates equality of objects
+		/// Returns the size of a single hit in bytes with the specified fields
 		/// </summary>
-		public override bool Equals(object value) {
-			if (value == null)
-				return false;
+		public static int GetStride(HitFields fields) {
+			int stride = 0;
 
-			if (!ReferenceEquals(value.GetType(), typeof(Bounds)))
-				return false;
+			for (int i = 0; i < fieldSizes.Length; i++) {
+				if (((int)fields & (1 << i)) != 0)
+					stride += fieldSizes[i];
+			}
 
-			return Equals((Bounds)value);
+			return (stride + IntPtr.Size - 1) & ~(IntPtr.Size - 1);
 		}
 
 		/// <summary>
-		/// Returns a hash code for the object
+		/// Returns the actor hit by the trace
 		/// </summary>
-		public override int GetHashCode() => HashCode.Combine(origin, boxExtent, sphereRadius);
-	}
+		public ActorReference GetActor(int index) => Read<ActorReference>(index, HitFields.Actor);
 
-	/// <summary>
-	/// A collision shape
-	/// </summary>
-	public partial struct CollisionShape : IEquatable<CollisionShape> {
 		/// <summary>
-		/// Returns the shape type
+		/// Returns the component hit by the trace
 		/// </summary>
-		public CollisionShapeType ShapeType => shapeType;
+		public ComponentReference GetComponent(int index) => Read<ComponentReference>(index, HitFields.Component);
 
 		/// <summary>
-		/// Returns a box shape
+		/// Returns the location in world space where the moving shape would end up against the impacted object
 		/// </summary>
-		public static CollisionShape CreateBox(in Vector3 halfExtent) {
-			CollisionShape collisionShape = default;
+		public Vector3 GetLocation(int index) => Read<Vector3>(index, HitFields.Location);
 
-			collisionShape.shapeType = CollisionShapeType.Box;
+		/// <summary>
+		/// Returns the location in world space of the actual contact of the trace shape with the impacted object
+		/// </summary>
+		public Vector3 GetImpactLocation(int index) => Read<Vector3>(index, HitFields.ImpactLocation);
+
+		/// <summary>
+		/// Returns the normal of the hit in world space for the object that was swept
+		/// </summary>
+		public Vector3 GetNormal(int index) => Read<Vector3>(index, HitFields.Normal);
+
+		/// <summary>
+		/// Returns the normal of the hit in world space for the object that was hit by the sweep
+		/// </summary>
+		public Vector3 GetImpactNormal(int index) => Read<Vector3>(index, HitFields.ImpactNormal);
+
+		/// <summary>
+		/// Returns the time from trace start to trace end
+		/// </summary>
+		public float GetTime(int index) => Read<float>(index, HitFields.Time);
+
+		/// <summary>
+		/// Returns the distance from trace start to hit location in world space
+		/// </summary>
+		public float GetDistance(int index) => Read<float>(index, HitFields.Distance);
+
+		/// <summary>
+		/// Returns the distance along the normal that will result in moving out of penetration
+		/// </summary>
+		public float GetPenetrationDepth(int index) => Read<float>(index, HitFields.PenetrationDepth);
+
+		/// <summary>
+		/// Returns the index of the bone that was hit on the skinned mesh, -1 if no bone was hit
+		/// </summary>
+		public int GetBoneIndex(int index) => Read<int>(index, HitFields.BoneIndex);
+
+		/// <summary>
+		/// Returns <c>true</c> if the hit was a result of blocking collision
+		/// </summary>
+		public bool IsBlockingHit(int index) => (Read<int>(index, HitFields.Flags) & 1) != 0;
+
+		/// <summary>
+		/// Returns <c>true</c> if the trace started in penetration
+		/// </summary>
+		public bool IsStartPenetrating(int index) => (Read<int>(index, HitFields.Flags) & 2) != 0;
+
+		private T Read<T>(int index, HitFields field) where T : struct {
+			if ((fields & field) == 0)
+				throw new InvalidOperationException("The field was not requested: " + field);
+
+			if ((uint)index >= (uint)Length)
+				throw new ArgumentOutOfRangeException(nameof(index));
+
+			int offset = index * stride;
+
+			for (int i = 0; (1 << i) < (int)field; i++) {
+				if (((int)fields & (1 << i)) != 0)
+					offset += fieldSizes[i];
+			}
+
+			return MemoryMarshal.Read<T>(buffer.Slice(offset));
+		}
+	}
+
+	/// <summary>
+	/// A snapshot of the actor state written by the engine at the end of the frame
+	/// </summary>
+	public partial struct ActorState : IEquatable<ActorState> {
+		/// <summary>
+		/// Returns the location of the actor in world space
+		/// </summary>
+		public Vector3 Location => location;
+
+		/// <summary>
+		/// Returns the rotation of the actor in world space
+		/// </summary>
+		public Quaternion Rotation => rotation;
+
+		/// <summary>
+		/// Returns the velocity of the actor
+		/// </summary>
+		public Vector3 Velocity => velocity;
+
+		/// <summary>
+		/// Returns <c>true</c> if the actor is hidden in game
+		/// </summary>
+		public bool IsHidden => hidden;
+
+		/// <summary>
+		/// Returns <c>true</c> if the snapshot is valid, <c>false</c> if the actor is not spawned or was not captured yet
+		/// </summary>
+		public bool IsValid => valid;
+
+		/// <summary>
+		/// Returns a string that represents this instance
+		/// </summary>
+		public override string ToString() => string.Format(CultureInfo.CurrentCulture, "Location:{0} Rotation:{1} Velocity:{2} Hidden:{3} Valid:{4}", Location, Rotation, Velocity, IsHidden, IsValid);
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(ActorState left, ActorState right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(ActorState left, ActorState right) => !left.Equals(right);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(ActorState other) => location == other.location && rotation == other.rotation && velocity == other.velocity && hidden == other.hidden && valid == other.valid;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) {
+			if (value == null)
+				return false;
+
+			if (!ReferenceEquals(value.GetType(), typeof(ActorState)))
+				return false;
+
+			return Equals((ActorState)value);
+		}
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(location, rotation, velocity, hidden, valid);
+	}
+
+	/// <summary>
+	/// A result of the asynchronous query delivered at the beginning of the next frame
+	/// </summary>
+	public partial struct AsyncQueryResult : IEquatable<AsyncQueryResult> {
+		/// <summary>
+		/// Returns the ticket of the query that produced the result
+		/// </summary>
+		public uint Ticket => ticket;
+
+		/// <summary>
+		/// Returns the hit, a query without hits or overlaps produces a single result without an actor
+		/// </summary>
+		public Hit Hit => hit;
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(AsyncQueryResult left, AsyncQueryResult right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(AsyncQueryResult left, AsyncQueryResult right) => !left.Equals(right);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(AsyncQueryResult other) => ticket == other.ticket && hit == other.hit;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) {
+			if (value == null)
+				return false;
+
+			if (!ReferenceEquals(value.GetType(), typeof(AsyncQueryResult)))
+				return false;
+
+			return Equals((AsyncQueryResult)value);
+		}
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(ticket, hit);
+	}
+
+	/// <summary>
+	/// A combined axis-aligned bounding box and bounding sphere with the same origin
+	/// </summary>
+	public partial struct Bounds : IEquatable<Bounds> {
+		/// <summary>
+		/// Returns the origin of the bounding box and sphere
+		/// </summary>
+		public Vector3 Origin => origin;
+
+		/// <summary>
+		/// Returns the extent of the bounding box
+		/// </summary>
+		public Vector3 BoxExtent => boxExtent;
+
+		/// <summary>
+		/// Returns the radius of the bounding sphere
+		/// </summary>
+		public float SphereRadius => sphereRadius;
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(Bounds left, Bounds right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(Bounds left, Bounds right) => !left.Equals(right);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(Bounds other) => origin == other.origin && boxExtent == other.boxExtent && sphereRadius == other.sphereRadius;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) {
+			if (value == null)
+				return false;
+
+			if (!ReferenceEquals(value.GetType(), typeof(Bounds)))
+				return false;
+
+			return Equals((Bounds)value);
+		}
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(origin, boxExtent, sphereRadius);
+	}
+
+	/// <summary>
+	/// A collision shape
+	/// </summary>
+	public partial struct CollisionShape : IEquatable<CollisionShape> {
+		/// <summary>
+		/// Returns the shape type
+		/// </summary>
+		public CollisionShapeType ShapeType => shapeType;
+
+		/// <summary>
+		/// Returns a box shape
+		/// </summary>
+		public static CollisionShape CreateBox(in Vector3 halfExtent) {
+			CollisionShape collisionShape = default;
+
+			collisionShape.shapeType = CollisionShapeType.Box;
 			collisionShape.box.halfExtent = halfExtent;
 
 			return collisionShape;
@@ -1891,6 +2674,16 @@ namespace UnrealEngine.Framework {
 	/// </summary>
 	public delegate void CharacterLandedDelegate(in Hit hit);
 
+	/// <summary>
+	/// Delegate for tick functions
+	/// </summary>
+	public delegate void TickDelegate(float deltaTime);
+
+	/// <summary>
+	/// Delegate for results of asynchronous queries
+	/// </summary>
+	public delegate void AsyncQueriesDelegate(ReadOnlySpan<AsyncQueryResult> results);
+
 	/// <summary>
 	/// Provides additional static constants and methods for mathematical functions that are lack in <see cref="System.Math"/>, <see cref="System.MathF"/>, and <see cref="System.Numerics"/>
 	/// </summary>
@@ -3953,6 +4746,9 @@ namespace UnrealEngine.Framework {
 	/// The top-level representation of a map or a sandbox in which actors and components will exist and rendered
 	/// </summary>
 	public static unsafe partial class World {
+		// Delegates of the registered tick functions are kept alive until the functions are unregistered
+		private static readonly Dictionary<int, TickDelegate> tickFunctions = new();
+
 		/// <summary>
 		/// Returns the actor count
 		/// </summary>
@@ -3995,27 +4791,65 @@ namespace UnrealEngine.Framework {
 		}
 
 		/// <summary>
-		/// Performs the specified action on each actor in the world
+		/// Performs the specified action on each actor in the world of the specified class
 		/// </summary>
 		public static unsafe void ForEachActor<T>(Action<T> action) where T : Actor {
 			if (action == null)
 				throw new ArgumentNullException(nameof(action));
 
-			ObjectReference* array = null;
-			int elements = 0;
+			Span<ActorReference> actors = stackalloc ActorReference[256];
+			long cursor = 0;
+			int elements;
 
-			forEachActor(ref array, ref elements);
+			// Actors are retrieved in chunks that continue where the previous chunk stopped
+			do {
+				elements = GetActors<T>(actors, ref cursor);
 
-			for (int i = 0; i < elements; i++) {
-				T actor = array[i].ToActor<T>();
+				for (int i = 0; i < elements; i++) {
+					T actor = FormatterServices.GetUninitializedObject(typeof(T)) as T;
+
+					actor.Pointer = actors[i].Pointer;
 
-				if (actor != null)
 					action(actor);
+				}
+			} while (elements == actors.Length);
+		}
+
+		/// <summary>
+		/// Retrieves actors in the world of the specified class to a span, only actors that fit into the span are retrieved
+		/// </summary>
+		/// <typeparam name="T">The type of the actors</typeparam>
+		/// <returns>The total number of actors of the specified class, may exceed the length of the span</returns>
+		public static unsafe int GetActors<T>(Span<ActorReference> actors) where T : Actor {
+			ActorType type = (FormatterServices.GetUninitializedObject(typeof(T)) as T).Type;
+
+			fixed (ActorReference* actorsPointer = actors) {
+				return getActors(type, null, actorsPointer, actors.Length);
+			}
+		}
+
+		/// <summary>
+		/// Retrieves actors in the world of the specified class to a span starting at the cursor, the cursor is advanced past the retrieved actors to continue the iteration in the next call
+		/// </summary>
+		/// <param name="actors">The span to fill</param>
+		/// <param name="cursor">The position of the iteration, zero to start from the first actor</param>
+		/// <typeparam name="T">The type of the actors</typeparam>
+		/// <returns>The number of retrieved actors, the iteration is complete once it is less than the length of the span</returns>
+		public static unsafe int GetActors<T>(Span<ActorReference> actors, ref long cursor) where T : Actor {
+			if (actors.Length == 0)
+				throw new ArgumentOutOfRangeException(nameof(actors));
+
+			ActorType type = (FormatterServices.GetUninitializedObject(typeof(T)) as T).Type;
+
+			fixed (ActorReference* actorsPointer = actors) {
+				fixed (long* cursorPointer = &cursor) {
+					return getActors(type, cursorPointer, actorsPointer, actors.Length);
+				}
 			}
 		}
 
 		/// <summary>
-		/// Returns the first actor in the world of the specified class, optionally with the specified name, this operation is slow and should be used with caution
+		/// Returns the first actor in the world of the specified class, optionally with the specified name
 		/// </summary>
 		/// <param name="name">The name of the actor, may differ from the label in the editor</param>
 		/// <typeparam name="T">The type of the actor</typeparam>
@@ -4034,7 +4868,7 @@ namespace UnrealEngine.Framework {
 		}
 
 		/// <summary>
-		/// Returns the first actor in the world of the specified class and tag, this operation is slow and should be used with caution
+		/// Returns the first actor in the world of the specified class and tag
 		/// </summary>
 		/// <param name="tag">The tag of the actor</param>
 		/// <typeparam name="T">The type of the actor</typeparam>
@@ -4053,7 +4887,32 @@ namespace UnrealEngine.Framework {
 		}
 
 		/// <summary>
-		/// Returns the first actor in the world of the specified class and ID, this operation is slow and should be used with caution
+		/// Returns all actors in the world of the specified class and tag, tags added to spawned actors outside of <see cref="Actor.AddTag(string)"/> are found only if no other actor matches
+		/// </summary>
+		/// <param name="tag">The tag of the actors</param>
+		/// <typeparam name="T">The type of the actors</typeparam>
+		/// <returns>An array of actors, empty if there are none</returns>
+		public static unsafe T[] GetActorsByTag<T>(string tag) where T : Actor {
+			ActorType type = (FormatterServices.GetUninitializedObject(typeof(T)) as T).Type;
+			ObjectReference* array = null;
+			int elements = 0;
+
+			getActorsByTag(tag.StringToBytes(), type, ref array, ref elements);
+
+			T[] actors = new T[elements];
+
+			for (int i = 0; i < elements; i++) {
+				T actor = FormatterServices.GetUninitializedObject(typeof(T)) as T;
+
+				actor.Pointer = array[i].Pointer;
+				actors[i] = actor;
+			}
+
+			return actors;
+		}
+
+		/// <summary>
+		/// Returns the first actor in the world of the specified class and ID
 		/// </summary>
 		/// <param name="id">The ID of the actor</param>
 		/// <typeparam name="T">The type of the actor</typeparam>
@@ -4120,7 +4979,9 @@ namespace UnrealEngine.Framework {
 			if (callback == null)
 				throw new ArgumentNullException(nameof(callback));
 
-			setOnActorBeginOverlapCallback(Collector.GetFunctionPointer(callback));
+			Events.onActorBeginOverlap = callback;
+
+			setOnActorBeginOverlapCallback((IntPtr)(delegate* unmanaged[Cdecl]<ActorReference, ActorReference, void>)&Events.OnActorBeginOverlap);
 		}
 
 		/// <summary>
@@ -4130,7 +4991,9 @@ namespace UnrealEngine.Framework {
 			if (callback == null)
 				throw new ArgumentNullException(nameof(callback));
 
-			setOnActorEndOverlapCallback(Collector.GetFunctionPointer(callback));
+			Events.onActorEndOverlap = callback;
+
+			setOnActorEndOverlapCallback((IntPtr)(delegate* unmanaged[Cdecl]<ActorReference, ActorReference, void>)&Events.OnActorEndOverlap);
 		}
 
 		/// <summary>
@@ -4140,7 +5003,9 @@ namespace UnrealEngine.Framework {
 			if (callback == null)
 				throw new ArgumentNullException(nameof(callback));
 
-			setOnActorHitCallback(Collector.GetFunctionPointer(callback));
+			Events.onActorHit = callback;
+
+			setOnActorHitCallback((IntPtr)(delegate* unmanaged[Cdecl]<ActorReference, ActorReference, Vector3*, Hit*, void>)&Events.OnActorHit);
 		}
 
 		/// <summary>
@@ -4150,7 +5015,9 @@ namespace UnrealEngine.Framework {
 			if (callback == null)
 				throw new ArgumentNullException(nameof(callback));
 
-			setOnActorBeginCursorOverCallback(Collector.GetFunctionPointer(callback));
+			Events.onActorBeginCursorOver = callback;
+
+			setOnActorBeginCursorOverCallback((IntPtr)(delegate* unmanaged[Cdecl]<ActorReference, void>)&Events.OnActorBeginCursorOver);
 		}
 
 		/// <summary>
@@ -4160,7 +5027,9 @@ namespace UnrealEngine.Framework {
 			if (callback == null)
 				throw new ArgumentNullException(nameof(callback));
 
-			setOnActorEndCursorOverCallback(Collector.GetFunctionPointer(callback));
+			Events.onActorEndCursorOver = callback;
+
+			setOnActorEndCursorOverCallback((IntPtr)(delegate* unmanaged[Cdecl]<ActorReference, void>)&Events.OnActorEndCursorOver);
 		}
 
 		/// <summary>
@@ -4170,7 +5039,9 @@ namespace UnrealEngine.Framework {
 			if (callback == null)
 				throw new ArgumentNullException(nameof(callback));
 
-			setOnActorClickedCallback(Collector.GetFunctionPointer(callback));
+			Events.onActorClicked = callback;
+
+			setOnActorClickedCallback((IntPtr)(delegate* unmanaged[Cdecl]<ActorReference, IntPtr, void>)&Events.OnActorClicked);
 		}
 
 		/// <summary>
@@ -4180,7 +5051,9 @@ namespace UnrealEngine.Framework {
 			if (callback == null)
 				throw new ArgumentNullException(nameof(callback));
 
-			setOnActorReleasedCallback(Collector.GetFunctionPointer(callback));
+			Events.onActorReleased = callback;
+
+			setOnActorReleasedCallback((IntPtr)(delegate* unmanaged[Cdecl]<ActorReference, IntPtr, void>)&Events.OnActorReleased);
 		}
 
 		/// <summary>
@@ -4190,212 +5063,1039 @@ namespace UnrealEngine.Framework {
 			if (callback == null)
 				throw new ArgumentNullException(nameof(callback));
 
-			setOnComponentBeginOverlapCallback(Collector.GetFunctionPointer(callback));
+			Events.onComponentBeginOverlap = callback;
+
+			setOnComponentBeginOverlapCallback((IntPtr)(delegate* unmanaged[Cdecl]<ComponentReference, ComponentReference, void>)&Events.OnComponentBeginOverlap);
+		}
+
+		/// <summary>
+		/// Sets the callback function that is called when primitive components end overlapping
+		/// </summary>
+		public static void SetOnComponentEndOverlapCallback(ComponentOverlapDelegate callback) {
+			if (callback == null)
+				throw new ArgumentNullException(nameof(callback));
+
+			Events.onComponentEndOverlap = callback;
+
+			setOnComponentEndOverlapCallback((IntPtr)(delegate* unmanaged[Cdecl]<ComponentReference, ComponentReference, void>)&Events.OnComponentEndOverlap);
+		}
+
+		/// <summary>
+		/// Sets the callback function that is called when components hit collisions
+		/// </summary>
+		public static void SetOnComponentHitCallback(ComponentHitDelegate callback) {
+			if (callback == null)
+				throw new ArgumentNullException(nameof(callback));
+
+			Events.onComponentHit = callback;
+
+			setOnComponentHitCallback((IntPtr)(delegate* unmanaged[Cdecl]<ComponentReference, ComponentReference, Vector3*, Hit*, void>)&Events.OnComponentHit);
+		}
+
+		/// <summary>
+		/// Sets the callback function that is called when the mouse cursor is moved over a component and mouse over events are enabled in the player controller
+		/// </summary>
+		public static void SetOnComponentBeginCursorOverCallback(ComponentCursorDelegate callback) {
+			if (callback == null)
+				throw new ArgumentNullException(nameof(callback));
+
+			Events.onComponentBeginCursorOver = callback;
+
+			setOnComponentBeginCursorOverCallback((IntPtr)(delegate* unmanaged[Cdecl]<ComponentReference, void>)&Events.OnComponentBeginCursorOver);
+		}
+
+		/// <summary>
+		/// Sets the callback function that is called when the mouse cursor is moved off a component and mouse over events are enabled in the player controller
+		/// </summary>
+		public static void SetOnComponentEndCursorOverCallback(ComponentCursorDelegate callback) {
+			if (callback == null)
+				throw new ArgumentNullException(nameof(callback));
+
+			Events.onComponentEndCursorOver = callback;
+
+			setOnComponentEndCursorOverCallback((IntPtr)(delegate* unmanaged[Cdecl]<ComponentReference, void>)&Events.OnComponentEndCursorOver);
+		}
+
+		/// <summary>
+		/// Sets the callback function that is called when the mouse button is clicked while the mouse is over a component if click events are enabled in the player controller
+		/// </summary>
+		public static void SetOnComponentClickedCallback(ComponentKeyDelegate callback) {
+			if (callback == null)
+				throw new ArgumentNullException(nameof(callback));
+
+			Events.onComponentClicked = callback;
+
+			setOnComponentClickedCallback((IntPtr)(delegate* unmanaged[Cdecl]<ComponentReference, IntPtr, void>)&Events.OnComponentClicked);
+		}
+
+		/// <summary>
+		/// Sets the callback function that is called when the mouse button is released while the mouse is over a component if click events are enabled in the player controller
+		/// </summary>
+		public static void SetOnComponentReleasedCallback(ComponentKeyDelegate callback) {
+			if (callback == null)
+				throw new ArgumentNullException(nameof(callback));
+
+			Events.onComponentReleased = callback;
+
+			setOnComponentReleasedCallback((IntPtr)(delegate* unmanaged[Cdecl]<ComponentReference, IntPtr, void>)&Events.OnComponentReleased);
+		}
+
+		/// <summary>
+		/// Sets whether overlap, hit, and cursor events are queued instead of dispatched immediately, queued events are dispatched to the callbacks in a single batch at the end of each tick group
+		/// </summary>
+		public static void SetEventsBatching(bool value) => setEventsBatching(value ? (IntPtr)(delegate* unmanaged[Cdecl]<int*, IntPtr*, IntPtr*, int*, Vector3*, Hit*, int, void>)&Events.OnEventsBatch : IntPtr.Zero);
+
+		/// <summary>
+		/// Sets whether the world tick callback of the tick group is executed on a worker thread in parallel with other work of the group instead of the game thread, only <see cref="TickGroup.DuringPhysics"/>, <see cref="TickGroup.PostPhysics"/>, and <see cref="TickGroup.PostUpdateWork"/> are supported, the callback must not access objects of the engine while running on a worker thread
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool SetRunOnAnyThread(TickGroup tickGroup, bool value) => setRunOnAnyThread(tickGroup, value);
+
+		/// <summary>
+		/// Registers the tick function that is scheduled by the engine, remains registered until the end of the world or until unregistered
+		/// </summary>
+		/// <param name="callback">The function to call when the tick function is executed</param>
+		/// <param name="tickGroup">The tick group to execute the function in</param>
+		/// <param name="tickInterval">The frequency in seconds at which the function is executed, if less than or equal to 0 then it will be executed every frame</param>
+		/// <param name="tickEvenWhenPaused">If <c>true</c>, the function is executed even when the game is paused</param>
+		/// <returns>A handle of the tick function on success, or <c>-1</c> otherwise</returns>
+		public static int RegisterTickFunction(TickDelegate callback, TickGroup tickGroup, float tickInterval = 0.0f, bool tickEvenWhenPaused = false) {
+			if (callback == null)
+				throw new ArgumentNullException(nameof(callback));
+
+			int handle = registerTickFunction(Marshal.GetFunctionPointerForDelegate(callback), tickGroup, tickInterval, tickEvenWhenPaused);
+
+			if (handle != -1)
+				tickFunctions[handle] = callback;
+
+			return handle;
+		}
+
+		/// <summary>
+		/// Unregisters the tick function
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool UnregisterTickFunction(int handle) {
+			if (!unregisterTickFunction(handle))
+				return false;
+
+			tickFunctions.Remove(handle);
+
+			return true;
+		}
+
+		/// <summary>
+		/// Sets whether the tick function is enabled
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool SetTickFunctionEnabled(int handle, bool value) => setTickFunctionEnabled(handle, value);
+
+		/// <summary>
+		/// Makes the tick function execute after the tick of the actor
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool AddTickPrerequisite(int handle, Actor actor) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
+
+			return addTickPrerequisiteActor(handle, actor.Pointer);
+		}
+
+		/// <summary>
+		/// Makes the tick function execute after the tick of the component
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool AddTickPrerequisite(int handle, ActorComponent component) {
+			if (component == null)
+				throw new ArgumentNullException(nameof(component));
+
+			return addTickPrerequisiteComponent(handle, component.Pointer);
+		}
+
+		/// <summary>
+		/// Sets the fixed time step of the <c>OnWorldFixedTick</c> event, all steps elapsed during the frame are executed at the beginning of the frame before the pre-physics tick, the interpolation alpha is passed to the last step and zero to the steps before it
+		/// </summary>
+		/// <param name="stepTime">The time step in seconds, if less than or equal to 0 then the event is disabled</param>
+		/// <param name="maxSubsteps">The maximum amount of steps per frame, the elapsed time beyond that is dropped</param>
+		public static void SetFixedTick(float stepTime, int maxSubsteps = 8) => setFixedTick(stepTime, maxSubsteps);
+
+		/// <summary>
+		/// Sets the gravity applied to all objects in the world
+		/// </summary>
+		public static void SetGravity(float value) => setGravity(value);
+
+		/// <summary>
+		/// Sets <a href="https://docs.unrealengine.com/en-US/Engine/LevelStreaming/WorldBrowser/index.html">world origin</a> to the specified location
+		/// </summary>
+		/// <returns><c>true</c> if the world origin was succesfuly shifted, or <c>false</c> if one of the levels are pending visibility update</returns>
+		public static bool SetWorldOrigin(in Vector3 value) => setWorldOrigin(value);
+
+		/// <summary>
+		/// Travels to another level
+		/// </summary>
+		public static void OpenLevel(string levelName) => openLevel(levelName.StringToBytes());
+
+		/// <summary>
+		/// Traces a ray against the world using a specific channel
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool LineTraceTestByChannel(in Vector3 start, in Vector3 end, CollisionChannel channel, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => lineTraceTestByChannel(start, end, channel, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Traces a ray against the world using a specific profile
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool LineTraceTestByProfile(in Vector3 start, in Vector3 end, string profileName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => lineTraceTestByProfile(start, end, profileName.StringToBytes(), traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Traces a ray against the world using a specific channel and retrieves the first blocking hit
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool LineTraceSingleByChannel(in Vector3 start, in Vector3 end, CollisionChannel channel, ref Hit hit, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => lineTraceSingleByChannel(start, end, channel, ref hit, null, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Traces a ray against the world using a specific channel and retrieves the first blocking hit with a bone name
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool LineTraceSingleByChannel(in Vector3 start, in Vector3 end, CollisionChannel channel, ref Hit hit, ref string boneName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			byte[] stringBuffer = ArrayPool.GetStringBuffer();
+
+			bool result = lineTraceSingleByChannel(start, end, channel, ref hit, stringBuffer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+			boneName = stringBuffer.BytesToString();
+
+			return result;
+		}
+
+		/// <summary>
+		/// Traces a ray against the world using a specific profile and retrieves the first blocking hit
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool LineTraceSingleByProfile(in Vector3 start, in Vector3 end, string profileName, ref Hit hit, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => lineTraceSingleByProfile(start, end, profileName.StringToBytes(), ref hit, null, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Traces a ray against the world using a specific profile and retrieves the first blocking hit with a bone name
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool LineTraceSingleByProfile(in Vector3 start, in Vector3 end, string profileName, ref Hit hit, ref string boneName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			byte[] stringBuffer = ArrayPool.GetStringBuffer();
+
+			bool result = lineTraceSingleByProfile(start, end, profileName.StringToBytes(), ref hit, stringBuffer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+			boneName = stringBuffer.BytesToString();
+
+			return result;
+		}
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific profile
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool SweepTestByChannel(in Vector3 start, in Vector3 end, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => sweepTestByChannel(start, end, rotation, channel, shape, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific profile
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool SweepTestByProfile(in Vector3 start, in Vector3 end, in Quaternion rotation, string profileName, in CollisionShape shape, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => sweepTestByProfile(start, end, rotation, profileName.StringToBytes(), shape, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific profile and retrieves the first blocking hit
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool SweepSingleByChannel(in Vector3 start, in Vector3 end, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, ref Hit hit, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => sweepSingleByChannel(start, end, rotation, channel, shape, ref hit, null, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific profile and retrieves the first blocking hit with a bone name
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool SweepSingleByChannel(in Vector3 start, in Vector3 end, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, ref Hit hit, ref string boneName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			byte[] stringBuffer = ArrayPool.GetStringBuffer();
+
+			bool result = sweepSingleByChannel(start, end, rotation, channel, shape, ref hit, stringBuffer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+			boneName = stringBuffer.BytesToString();
+
+			return result;
+		}
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific profile and retrieves the first blocking hit
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool SweepSingleByProfile(in Vector3 start, in Vector3 end, in Quaternion rotation, string profileName, in CollisionShape shape, ref Hit hit, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => sweepSingleByProfile(start, end, rotation, profileName.StringToBytes(), shape, ref hit, null, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific profile and retrieves the first blocking hit with a bone name
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool SweepSingleByProfile(in Vector3 start, in Vector3 end, in Quaternion rotation, string profileName, in CollisionShape shape, ref Hit hit, ref string boneName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			byte[] stringBuffer = ArrayPool.GetStringBuffer();
+
+			bool result = sweepSingleByProfile(start, end, rotation, profileName.StringToBytes(), shape, ref hit, stringBuffer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+			boneName = stringBuffer.BytesToString();
+
+			return result;
+		}
+
+		/// <summary>
+		/// Tests the collision shape at the specified location using a specific channel to determine if any blocking or overlapping occurred
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool OverlapAnyTestByChannel(in Vector3 location, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => overlapAnyTestByChannel(location, rotation, channel, shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Tests the collision shape at the specified location using a specific profile to determine if any blocking or overlapping occurred
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool OverlapAnyTestByProfile(in Vector3 location, in Quaternion rotation, string profileName, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => overlapAnyTestByProfile(location, rotation, profileName.StringToBytes(), shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Tests the collision shape at the specified location using a specific channel to determine if any blocking occurred
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool OverlapBlockingTestByChannel(in Vector3 location, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => overlapBlockingTestByChannel(location, rotation, channel, shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Tests the collision shape at the specified location using a specific profile to determine if any blocking occurred
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool OverlapBlockingTestByProfile(in Vector3 location, in Quaternion rotation, string profileName, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => overlapBlockingTestByProfile(location, rotation, profileName.StringToBytes(), shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Traces a ray against the world using a specific channel and retrieves all hits up to and including the first blocking hit to a span, only hits that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of hits, may exceed the length of the span</returns>
+		public static int LineTraceMultiByChannel(in Vector3 start, in Vector3 end, CollisionChannel channel, Span<Hit> hits, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			fixed (Hit* hitsPointer = hits) {
+				return lineTraceMultiByChannel(start, end, channel, hitsPointer, hits.Length, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			}
+		}
+
+		/// <summary>
+		/// Traces a ray against the world using a specific profile and retrieves all hits up to and including the first blocking hit to a span, only hits that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of hits, may exceed the length of the span</returns>
+		public static int LineTraceMultiByProfile(in Vector3 start, in Vector3 end, string profileName, Span<Hit> hits, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			fixed (Hit* hitsPointer = hits) {
+				return lineTraceMultiByProfile(start, end, profileName.StringToBytes(), hitsPointer, hits.Length, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			}
+		}
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific channel and retrieves all hits up to and including the first blocking hit to a span, only hits that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of hits, may exceed the length of the span</returns>
+		public static int SweepMultiByChannel(in Vector3 start, in Vector3 end, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, Span<Hit> hits, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			fixed (Hit* hitsPointer = hits) {
+				return sweepMultiByChannel(start, end, rotation, channel, shape, hitsPointer, hits.Length, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			}
+		}
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific profile and retrieves all hits up to and including the first blocking hit to a span, only hits that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of hits, may exceed the length of the span</returns>
+		public static int SweepMultiByProfile(in Vector3 start, in Vector3 end, in Quaternion rotation, string profileName, in CollisionShape shape, Span<Hit> hits, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			fixed (Hit* hitsPointer = hits) {
+				return sweepMultiByProfile(start, end, rotation, profileName.StringToBytes(), shape, hitsPointer, hits.Length, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			}
+		}
+
+		/// <summary>
+		/// Retrieves components overlapping a shape using a specific channel to a span, only components that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of overlapping components, may exceed the length of the span</returns>
+		public static int OverlapMultiByChannel(in Vector3 location, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, Span<ComponentReference> components, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			fixed (ComponentReference* componentsPointer = components) {
+				return overlapMultiByChannel(location, rotation, channel, shape, componentsPointer, components.Length, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			}
+		}
+
+		/// <summary>
+		/// Retrieves components overlapping a shape using a specific profile to a span, only components that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of overlapping components, may exceed the length of the span</returns>
+		public static int OverlapMultiByProfile(in Vector3 location, in Quaternion rotation, string profileName, in CollisionShape shape, Span<ComponentReference> components, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			fixed (ComponentReference* componentsPointer = components) {
+				return overlapMultiByProfile(location, rotation, profileName.StringToBytes(), shape, componentsPointer, components.Length, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			}
+		}
+
+		/// <summary>
+		/// Traces rays against the world using a specific channel in a single call and sets a bit of the mask for each ray that hit anything
+		/// </summary>
+		/// <param name="starts">The start locations of the rays</param>
+		/// <param name="ends">The end locations of the rays</param>
+		/// <param name="channel">The channel to trace against</param>
+		/// <param name="hitMask">The mask with a bit per ray, should be at least <c>(starts.Length + 7) / 8</c> bytes long</param>
+		/// <param name="traceComplex">If <c>true</c>, traces against complex collision</param>
+		/// <param name="ignoredActor">The actor to ignore</param>
+		/// <param name="ignoredComponent">The component to ignore</param>
+		/// <returns>The number of rays that hit anything</returns>
+		public static int LineTraceBatchByChannel(ReadOnlySpan<Vector3> starts, ReadOnlySpan<Vector3> ends, CollisionChannel channel, Span<byte> hitMask, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => LineTraceBatchByChannel(starts, ends, channel, Span<Hit>.Empty, hitMask, traceComplex, ignoredActor, ignoredComponent);
+
+		/// <summary>
+		/// Traces rays against the world using a specific channel in a single call and retrieves the first blocking hit of each ray
+		/// </summary>
+		/// <param name="starts">The start locations of the rays</param>
+		/// <param name="ends">The end locations of the rays</param>
+		/// <param name="channel">The channel to trace against</param>
+		/// <param name="hits">The hits of the rays, valid only where the bit of the mask is set</param>
+		/// <param name="hitMask">The mask with a bit per ray, should be at least <c>(starts.Length + 7) / 8</c> bytes long</param>
+		/// <param name="traceComplex">If <c>true</c>, traces against complex collision</param>
+		/// <param name="ignoredActor">The actor to ignore</param>
+		/// <param name="ignoredComponent">The component to ignore</param>
+		/// <returns>The number of rays that hit anything</returns>
+		public static int LineTraceBatchByChannel(ReadOnlySpan<Vector3> starts, ReadOnlySpan<Vector3> ends, CollisionChannel channel, Span<Hit> hits, Span<byte> hitMask, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			int count = starts.Length;
+
+			if (ends.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(ends));
+
+			if (!hits.IsEmpty && hits.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(hits));
+
+			if (hitMask.Length < (count + 7) / 8)
+				throw new ArgumentOutOfRangeException(nameof(hitMask));
+
+			fixed (Vector3* startsPointer = starts) {
+				fixed (Vector3* endsPointer = ends) {
+					fixed (Hit* hitsPointer = hits) {
+						fixed (byte* hitMaskPointer = hitMask) {
+							return lineTraceBatchByChannel(startsPointer, endsPointer, count, channel, hitsPointer, hitMaskPointer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+						}
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific channel in a single call and sets a bit of the mask for each sweep that hit anything
+		/// </summary>
+		/// <param name="starts">The start locations of the sweeps</param>
+		/// <param name="ends">The end locations of the sweeps</param>
+		/// <param name="rotations">The rotations of the shape for each sweep, identity is used if empty</param>
+		/// <param name="channel">The channel to sweep against</param>
+		/// <param name="shape">The shape to sweep</param>
+		/// <param name="hitMask">The mask with a bit per sweep, should be at least <c>(starts.Length + 7) / 8</c> bytes long</param>
+		/// <param name="traceComplex">If <c>true</c>, sweeps against complex collision</param>
+		/// <param name="ignoredActor">The actor to ignore</param>
+		/// <param name="ignoredComponent">The component to ignore</param>
+		/// <returns>The number of sweeps that hit anything</returns>
+		public static int SweepBatchByChannel(ReadOnlySpan<Vector3> starts, ReadOnlySpan<Vector3> ends, ReadOnlySpan<Quaternion> rotations, CollisionChannel channel, in CollisionShape shape, Span<byte> hitMask, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => SweepBatchByChannel(starts, ends, rotations, channel, shape, Span<Hit>.Empty, hitMask, traceComplex, ignoredActor, ignoredComponent);
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific channel in a single call and retrieves the first blocking hit of each sweep
+		/// </summary>
+		/// <param name="starts">The start locations of the sweeps</param>
+		/// <param name="ends">The end locations of the sweeps</param>
+		/// <param name="rotations">The rotations of the shape for each sweep, identity is used if empty</param>
+		/// <param name="channel">The channel to sweep against</param>
+		/// <param name="shape">The shape to sweep</param>
+		/// <param name="hits">The hits of the sweeps, valid only where the bit of the mask is set</param>
+		/// <param name="hitMask">The mask with a bit per sweep, should be at least <c>(starts.Length + 7) / 8</c> bytes long</param>
+		/// <param name="traceComplex">If <c>true</c>, sweeps against complex collision</param>
+		/// <param name="ignoredActor">The actor to ignore</param>
+		/// <param name="ignoredComponent">The component to ignore</param>
+		/// <returns>The number of sweeps that hit anything</returns>
+		public static int SweepBatchByChannel(ReadOnlySpan<Vector3> starts, ReadOnlySpan<Vector3> ends, ReadOnlySpan<Quaternion> rotations, CollisionChannel channel, in CollisionShape shape, Span<Hit> hits, Span<byte> hitMask, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
+			int count = starts.Length;
+
+			if (ends.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(ends));
+
+			if (!rotations.IsEmpty && rotations.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(rotations));
+
+			if (!hits.IsEmpty && hits.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(hits));
+
+			if (hitMask.Length < (count + 7) / 8)
+				throw new ArgumentOutOfRangeException(nameof(hitMask));
+
+			fixed (Vector3* startsPointer = starts) {
+				fixed (Vector3* endsPointer = ends) {
+					fixed (Quaternion* rotationsPointer = rotations) {
+						fixed (Hit* hitsPointer = hits) {
+							fixed (byte* hitMaskPointer = hitMask) {
+								return sweepBatchByChannel(startsPointer, endsPointer, rotationsPointer, count, channel, shape, hitsPointer, hitMaskPointer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Sets the callback function that is called with results of asynchronous queries before the pre-physics tick of the frame after the queries were issued, the span is valid only during the call
+		/// </summary>
+		public static void SetOnAsyncQueriesCallback(AsyncQueriesDelegate callback) {
+			if (callback == null)
+				throw new ArgumentNullException(nameof(callback));
+
+			Events.onAsyncQueries = callback;
+
+			setOnAsyncQueriesCallback((IntPtr)(delegate* unmanaged[Cdecl]<AsyncQueryResult*, int, void>)&Events.OnAsyncQueries);
+		}
+
+		/// <summary>
+		/// Traces a ray against the world using a specific channel off the game thread, results are delivered to the callback set with <see cref="SetOnAsyncQueriesCallback"/> in the next frame, all hits up to the first blocking one are retrieved if multi is <c>true</c>
+		/// </summary>
+		/// <returns>The ticket of the query</returns>
+		public static uint AsyncLineTraceByChannel(in Vector3 start, in Vector3 end, CollisionChannel channel, bool multi = false, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => asyncLineTraceByChannel(start, end, channel, multi, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Sweeps a shape against the world using a specific channel off the game thread, results are delivered to the callback set with <see cref="SetOnAsyncQueriesCallback"/> in the next frame, all hits up to the first blocking one are retrieved if multi is <c>true</c>
+		/// </summary>
+		/// <returns>The ticket of the query</returns>
+		public static uint AsyncSweepByChannel(in Vector3 start, in Vector3 end, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, bool multi = false, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => asyncSweepByChannel(start, end, rotation, channel, shape, multi, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+
+		/// <summary>
+		/// Tests a shape for overlaps against the world using a specific channel off the game thread, each overlap is delivered as a hit to the callback set with <see cref="SetOnAsyncQueriesCallback"/> in the next frame
+		/// </summary>
+		/// <returns>The ticket of the query</returns>
+		public static uint AsyncOverlapByChannel(in Vector3 location, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => asyncOverlapByChannel(location, rotation, channel, shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+	}
+
+	/// <summary>
+	/// Functionality for scheduling jobs on worker threads of the engine task graph
+	/// </summary>
+	public static unsafe partial class Jobs {
+		private sealed class Job {
+			internal Delegate callback;
+			internal int remaining;
+		}
+
+		/// <summary>
+		/// Schedules the job for execution on a worker thread once all prerequisites are complete, the job must not access objects of the engine
+		/// </summary>
+		/// <param name="job">The function to execute</param>
+		/// <param name="prerequisites">Handles of the jobs that should be completed before execution</param>
+		/// <returns>A handle of the job that remains valid until released, or <c>-1</c> if any prerequisite is not a handle of a scheduled job</returns>
+		public static int Schedule(Action job, ReadOnlySpan<int> prerequisites = default) {
+			if (job == null)
+				throw new ArgumentNullException(nameof(job));
+
+			GCHandle state = GCHandle.Alloc(new Job { callback = job, remaining = 1 });
+			int handle;
+
+			fixed (int* prerequisitesPointer = prerequisites) {
+				handle = schedule((IntPtr)(delegate* unmanaged[Cdecl]<IntPtr, int, int, void>)&Execute, GCHandle.ToIntPtr(state), prerequisitesPointer, prerequisites.Length);
+			}
+
+			if (handle == -1)
+				state.Free();
+
+			return handle;
+		}
+
+		/// <summary>
+		/// Schedules the job for parallel execution on worker threads once all prerequisites are complete, the range of elements is split into batches that are executed independently, the job must not access objects of the engine
+		/// </summary>
+		/// <param name="job">The function to execute with the inclusive beginning and the exclusive end of the batch</param>
+		/// <param name="count">The number of elements to process</param>
+		/// <param name="batchSize">The number of elements processed by a single batch</param>
+		/// <param name="prerequisites">Handles of the jobs that should be completed before execution</param>
+		/// <returns>A handle of the fence that is completed when all batches are complete, remains valid until released, or <c>-1</c> if any prerequisite is not a handle of a scheduled job</returns>
+		public static int ScheduleParallel(Action<int, int> job, int count, int batchSize, ReadOnlySpan<int> prerequisites = default) {
+			if (job == null)
+				throw new ArgumentNullException(nameof(job));
+
+			if (batchSize < 1)
+				batchSize = 1;
+
+			int batches = count > 0 ? (int)(((long)count + batchSize - 1) / batchSize) : 0;
+			GCHandle state = batches > 0 ? GCHandle.Alloc(new Job { callback = job, remaining = batches }) : default;
+			int handle;
+
+			fixed (int* prerequisitesPointer = prerequisites) {
+				handle = scheduleParallel((IntPtr)(delegate* unmanaged[Cdecl]<IntPtr, int, int, void>)&Execute, state.IsAllocated ? GCHandle.ToIntPtr(state) : IntPtr.Zero, count, batchSize, prerequisitesPointer, prerequisites.Length);
+			}
+
+			if (handle == -1 && state.IsAllocated)
+				state.Free();
+
+			return handle;
+		}
+
+		/// <summary>
+		/// Indicates whether the job is complete
+		/// </summary>
+		public static bool IsCompleted(int handle) => isCompleted(handle);
+
+		/// <summary>
+		/// Blocks the calling thread until the job is complete
+		/// </summary>
+		public static void Wait(int handle) => wait(handle);
+
+		/// <summary>
+		/// Releases the handle of the job, the job itself is not canceled
+		/// </summary>
+		public static void Release(int handle) => release(handle);
+
+		[UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+		private static void Execute(IntPtr state, int begin, int end) {
+			GCHandle handle = GCHandle.FromIntPtr(state);
+			Job job = (Job)handle.Target;
+
+			try {
+				if (job.callback is Action<int, int> range)
+					range(begin, end);
+				else
+					((Action)job.callback)();
+			}
+
+			catch (Exception exception) {
+				Events.Report(exception);
+			}
+
+			finally {
+				if (Interlocked.Decrement(ref job.remaining) == 0)
+					handle.Free();
+			}
+		}
+	}
+
+	/// <summary>
+	/// An opt-in spatial hash of actor locations for proximity queries without physics, locations are updated when the root component of an actor is moved, destroyed actors are never retrieved
+	/// </summary>
+	public static unsafe partial class SpatialHash {
+		/// <summary>
+		/// Sets the size of the cells and rebuilds the spatial hash, should be close to the typical radius of queries
+		/// </summary>
+		public static void SetCellSize(float cellSize) => setCellSize(cellSize);
+
+		/// <summary>
+		/// Adds the actor to the spatial hash
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool Add(Actor actor) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
+
+			return add(actor.Pointer);
+		}
+
+		/// <summary>
+		/// Removes the actor from the spatial hash
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool Remove(Actor actor) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
+
+			return remove(actor.Pointer);
+		}
+
+		/// <summary>
+		/// Retrieves actors within the radius from the center to a span, only actors that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of actors within the radius, may exceed the length of the span</returns>
+		public static int QueryRadius(in Vector3 center, float radius, Span<ActorReference> actors) {
+			fixed (ActorReference* actorsPointer = actors) {
+				return queryRadius(center, radius, actorsPointer, actors.Length);
+			}
+		}
+
+		/// <summary>
+		/// Retrieves actors within the axis-aligned box to a span, only actors that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of actors within the box, may exceed the length of the span</returns>
+		public static int QueryBox(in Vector3 min, in Vector3 max, Span<ActorReference> actors) {
+			fixed (ActorReference* actorsPointer = actors) {
+				return queryBox(min, max, actorsPointer, actors.Length);
+			}
+		}
+
+		/// <summary>
+		/// Retrieves the nearest actors to the center ordered by distance to a span, the number of actors is limited by the length of the span
+		/// </summary>
+		/// <param name="center">The location to measure the distance from</param>
+		/// <param name="actors">The span to retrieve the actors to</param>
+		/// <param name="maxDistance">The maximum distance to the actors, zero for no limit</param>
+		/// <returns>The number of retrieved actors</returns>
+		public static int QueryKNearest(in Vector3 center, Span<ActorReference> actors, float maxDistance = 0.0f) {
+			fixed (ActorReference* actorsPointer = actors) {
+				return queryKNearest(center, maxDistance, actorsPointer, actors.Length);
+			}
+		}
+	}
+
+	/// <summary>
+	/// A mirror of actor states in memory shared with the engine, the states of registered actors are captured once per frame after the post-update tick
+	/// </summary>
+	public static unsafe partial class Mirror {
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Table {
+			internal ActorState* firstBuffer;
+			internal ActorState* secondBuffer;
+			internal int current;
+			internal int length;
+		}
+
+		private static Table* table;
+
+		private static Table* SharedTable {
+			get {
+				if (table == null)
+					table = (Table*)getTable();
+
+				return table;
+			}
+		}
+
+		/// <summary>
+		/// Returns the latest captured states indexed by the slots of the actors, the states remain unchanged until the end of the next frame
+		/// </summary>
+		public static ReadOnlySpan<ActorState> States {
+			get {
+				Table* shared = SharedTable;
+
+				// The length is read first since the engine publishes it after the buffers when they grow
+				int length = Volatile.Read(ref shared->length);
+
+				return new(shared->current == 0 ? shared->firstBuffer : shared->secondBuffer, length);
+			}
+		}
+
+		/// <summary>
+		/// Registers the actor in the mirror, spans of states obtained earlier remain readable but do not include the new slot
+		/// </summary>
+		/// <returns>The slot of the actor in <see cref="States"/> or -1 on failure</returns>
+		public static int Add(Actor actor) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
+
+			return add(actor.Pointer);
+		}
+
+		/// <summary>
+		/// Unregisters the actor from the mirror, the state of its slot becomes invalid on the next update, actors are unregistered automatically once destroyed
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public static bool Remove(Actor actor) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
+
+			return remove(actor.Pointer);
+		}
+	}
+
+	/// <summary>
+	/// Functionality for reusing actors instead of spawning and destroying them, pool statistics are available with the <c>stat UnrealCLR</c> command
+	/// </summary>
+	public static unsafe partial class ActorPool {
+		/// <summary>
+		/// Reactivates a released actor of the specified class at the transform or spawns a new one if the pool is empty, a reactivated actor regains the visibility, collision, ticking, and spatial hash registration it had when released, and its <see cref="Mirror"/> slot may change
+		/// </summary>
+		/// <param name="transform">The transform of the actor in world space</param>
+		/// <param name="blueprint">The blueprint class to use as a base class, should be equal to the exact type of the actor</param>
+		/// <typeparam name="T">The type of the actor</typeparam>
+		/// <returns>An actor or <c>null</c> on failure</returns>
+		public static T Acquire<T>(in Transform transform, Blueprint blueprint = null) where T : Actor {
+			T actor = FormatterServices.GetUninitializedObject(typeof(T)) as T;
+
+			if (blueprint != null && !blueprint.IsValidClass(actor.Type))
+				throw new InvalidOperationException();
+
+			IntPtr pointer = acquire(actor.Type, blueprint != null ? blueprint.Pointer : IntPtr.Zero, transform);
+
+			if (pointer != IntPtr.Zero) {
+				actor.Pointer = pointer;
+
+				return actor;
+			}
+
+			return null;
 		}
 
 		/// <summary>
-		/// Sets the callback function that is called when primitive components end overlapping
+		/// Hides the actor, disables its collision and ticking, removes it from lookups, the spatial hash, and the mirror, and parks it in the pool of its class for reuse
 		/// </summary>
-		public static void SetOnComponentEndOverlapCallback(ComponentOverlapDelegate callback) {
-			if (callback == null)
-				throw new ArgumentNullException(nameof(callback));
+		/// <returns><c>true</c> on success</returns>
+		public static bool Release(Actor actor) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
 
-			setOnComponentEndOverlapCallback(Collector.GetFunctionPointer(callback));
+			return release(actor.Pointer);
 		}
 
 		/// <summary>
-		/// Sets the callback function that is called when components hit collisions
+		/// Spawns the specified number of actors and parks them in the pool ahead of time
 		/// </summary>
-		public static void SetOnComponentHitCallback(ComponentHitDelegate callback) {
-			if (callback == null)
-				throw new ArgumentNullException(nameof(callback));
+		/// <param name="count">The number of actors to spawn</param>
+		/// <param name="blueprint">The blueprint class to use as a base class, should be equal to the exact type of the actor</param>
+		/// <typeparam name="T">The type of the actors</typeparam>
+		public static void Prewarm<T>(int count, Blueprint blueprint = null) where T : Actor {
+			ActorType type = (FormatterServices.GetUninitializedObject(typeof(T)) as T).Type;
+
+			if (blueprint != null && !blueprint.IsValidClass(type))
+				throw new InvalidOperationException();
 
-			setOnComponentHitCallback(Collector.GetFunctionPointer(callback));
+			prewarm(type, blueprint != null ? blueprint.Pointer : IntPtr.Zero, count);
 		}
+	}
 
+	/// <summary>
+	/// Functionality for reusable collision query descriptors that hold the channel or profile, object types, ignored objects, and flags of traces, sweeps, and overlaps
+	/// </summary>
+	public static unsafe partial class CollisionQuery {
 		/// <summary>
-		/// Sets the callback function that is called when the mouse cursor is moved over a component and mouse over events are enabled in the player controller
+		/// Creates a query descriptor that uses a specific channel
 		/// </summary>
-		public static void SetOnComponentBeginCursorOverCallback(ComponentCursorDelegate callback) {
-			if (callback == null)
-				throw new ArgumentNullException(nameof(callback));
-
-			setOnComponentBeginCursorOverCallback(Collector.GetFunctionPointer(callback));
-		}
+		/// <returns>A handle of the descriptor, or <c>-1</c> on failure</returns>
+		public static int Create(CollisionChannel channel, bool traceComplex = false) => create(channel, null, traceComplex);
 
 		/// <summary>
-		/// Sets the callback function that is called when the mouse cursor is moved off a component and mouse over events are enabled in the player controller
+		/// Creates a query descriptor that uses a specific profile, the name is resolved once on creation
 		/// </summary>
-		public static void SetOnComponentEndCursorOverCallback(ComponentCursorDelegate callback) {
-			if (callback == null)
-				throw new ArgumentNullException(nameof(callback));
+		/// <returns>A handle of the descriptor, or <c>-1</c> on failure</returns>
+		public static int Create(string profileName, bool traceComplex = false) {
+			if (profileName == null)
+				throw new ArgumentNullException(nameof(profileName));
 
-			setOnComponentEndCursorOverCallback(Collector.GetFunctionPointer(callback));
+			return create(default, profileName.StringToBytes(), traceComplex);
 		}
 
 		/// <summary>
-		/// Sets the callback function that is called when the mouse button is clicked while the mouse is over a component if click events are enabled in the player controller
+		/// Destroys the query descriptor, the handle is rejected by all functions afterwards even if a new descriptor reuses its storage
 		/// </summary>
-		public static void SetOnComponentClickedCallback(ComponentKeyDelegate callback) {
-			if (callback == null)
-				throw new ArgumentNullException(nameof(callback));
-
-			setOnComponentClickedCallback(Collector.GetFunctionPointer(callback));
-		}
+		/// <returns><c>true</c> on success</returns>
+		public static bool Destroy(int handle) => destroy(handle);
 
 		/// <summary>
-		/// Sets the callback function that is called when the mouse button is released while the mouse is over a component if click events are enabled in the player controller
+		/// Adds the actor to the list of ignored actors of the query descriptor
 		/// </summary>
-		public static void SetOnComponentReleasedCallback(ComponentKeyDelegate callback) {
-			if (callback == null)
-				throw new ArgumentNullException(nameof(callback));
+		/// <returns><c>true</c> on success</returns>
+		public static bool AddIgnoredActor(int handle, Actor actor) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
 
-			setOnComponentReleasedCallback(Collector.GetFunctionPointer(callback));
+			return addIgnoredActor(handle, actor.Pointer);
 		}
 
 		/// <summary>
-		/// Sets the gravity applied to all objects in the world
+		/// Adds the component to the list of ignored components of the query descriptor
 		/// </summary>
-		public static void SetGravity(float value) => setGravity(value);
+		/// <returns><c>true</c> on success</returns>
+		public static bool AddIgnoredComponent(int handle, PrimitiveComponent component) {
+			if (component == null)
+				throw new ArgumentNullException(nameof(component));
+
+			return addIgnoredComponent(handle, component.Pointer);
+		}
 
 		/// <summary>
-		/// Sets <a href="https://docs.unrealengine.com/en-US/Engine/LevelStreaming/WorldBrowser/index.html">world origin</a> to the specified location
+		/// Clears ignored actors and components of the query descriptor
 		/// </summary>
-		/// <returns><c>true</c> if the world origin was succesfuly shifted, or <c>false</c> if one of the levels are pending visibility update</returns>
-		public static bool SetWorldOrigin(in Vector3 value) => setWorldOrigin(value);
+		/// <returns><c>true</c> on success</returns>
+		public static bool ClearIgnored(int handle) => clearIgnored(handle);
 
 		/// <summary>
-		/// Travels to another level
+		/// Adds the object type to the query descriptor, once any object type is added the query matches objects by their types instead of the channel or profile
 		/// </summary>
-		public static void OpenLevel(string levelName) => openLevel(levelName.StringToBytes());
+		/// <returns><c>true</c> on success</returns>
+		public static bool AddObjectType(int handle, CollisionChannel objectType) => addObjectType(handle, objectType);
 
 		/// <summary>
-		/// Traces a ray against the world using a specific channel
+		/// Sets the mobility of objects that the query descriptor considers
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public static bool LineTraceTestByChannel(in Vector3 start, in Vector3 end, CollisionChannel channel, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => lineTraceTestByChannel(start, end, channel, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		public static bool SetMobility(int handle, QueryMobility mobility) => setMobility(handle, mobility);
 
 		/// <summary>
-		/// Traces a ray against the world using a specific profile
+		/// Sets whether the query descriptor traces against complex collision
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public static bool LineTraceTestByProfile(in Vector3 start, in Vector3 end, string profileName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => lineTraceTestByProfile(start, end, profileName.StringToBytes(), traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		public static bool SetTraceComplex(int handle, bool value) => setTraceComplex(handle, value);
 
 		/// <summary>
-		/// Traces a ray against the world using a specific channel and retrieves the first blocking hit
+		/// Traces a ray against the world using the query descriptor
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public static bool LineTraceSingleByChannel(in Vector3 start, in Vector3 end, CollisionChannel channel, ref Hit hit, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => lineTraceSingleByChannel(start, end, channel, ref hit, null, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		public static bool LineTraceTest(int handle, in Vector3 start, in Vector3 end) => lineTraceTest(handle, start, end);
 
 		/// <summary>
-		/// Traces a ray against the world using a specific channel and retrieves the first blocking hit with a bone name
+		/// Traces a ray against the world using the query descriptor and retrieves the first blocking hit
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public static bool LineTraceSingleByChannel(in Vector3 start, in Vector3 end, CollisionChannel channel, ref Hit hit, ref string boneName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
-			byte[] stringBuffer = ArrayPool.GetStringBuffer();
-
-			bool result = lineTraceSingleByChannel(start, end, channel, ref hit, stringBuffer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
-
-			boneName = stringBuffer.BytesToString();
-
-			return result;
-		}
+		public static bool LineTraceSingle(int handle, in Vector3 start, in Vector3 end, ref Hit hit) => lineTraceSingle(handle, start, end, ref hit);
 
 		/// <summary>
-		/// Traces a ray against the world using a specific profile and retrieves the first blocking hit
+		/// Traces a ray against the world using the query descriptor and retrieves all hits up to and including the first blocking hit to a span, only hits that fit into the span are retrieved
 		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool LineTraceSingleByProfile(in Vector3 start, in Vector3 end, string profileName, ref Hit hit, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => lineTraceSingleByProfile(start, end, profileName.StringToBytes(), ref hit, null, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		/// <returns>The total number of hits, may exceed the length of the span</returns>
+		public static int LineTraceMulti(int handle, in Vector3 start, in Vector3 end, Span<Hit> hits) {
+			fixed (Hit* hitsPointer = hits) {
+				return lineTraceMulti(handle, start, end, hitsPointer, hits.Length);
+			}
+		}
 
 		/// <summary>
-		/// Traces a ray against the world using a specific profile and retrieves the first blocking hit with a bone name
+		/// Traces rays against the world using the query descriptor in a single call, sets a bit of the mask for each ray that hit anything and retrieves the first blocking hit of each ray if the span of hits is not empty
 		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool LineTraceSingleByProfile(in Vector3 start, in Vector3 end, string profileName, ref Hit hit, ref string boneName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
-			byte[] stringBuffer = ArrayPool.GetStringBuffer();
+		/// <returns>The number of rays that hit anything</returns>
+		public static int LineTraceBatch(int handle, ReadOnlySpan<Vector3> starts, ReadOnlySpan<Vector3> ends, Span<Hit> hits, Span<byte> hitMask) {
+			int count = starts.Length;
 
-			bool result = lineTraceSingleByProfile(start, end, profileName.StringToBytes(), ref hit, stringBuffer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			if (ends.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(ends));
 
-			boneName = stringBuffer.BytesToString();
+			if (!hits.IsEmpty && hits.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(hits));
 
-			return result;
+			if (hitMask.Length < (count + 7) / 8)
+				throw new ArgumentOutOfRangeException(nameof(hitMask));
+
+			fixed (Vector3* startsPointer = starts) {
+				fixed (Vector3* endsPointer = ends) {
+					fixed (Hit* hitsPointer = hits) {
+						fixed (byte* hitMaskPointer = hitMask) {
+							return lineTraceBatch(handle, startsPointer, endsPointer, count, hitsPointer, hitMaskPointer);
+						}
+					}
+				}
+			}
 		}
 
 		/// <summary>
-		/// Sweeps a shape against the world using a specific profile
+		/// Sweeps a shape against the world using the query descriptor
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public static bool SweepTestByChannel(in Vector3 start, in Vector3 end, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => sweepTestByChannel(start, end, rotation, channel, shape, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		public static bool SweepTest(int handle, in Vector3 start, in Vector3 end, in Quaternion rotation, in CollisionShape shape) => sweepTest(handle, start, end, rotation, shape);
 
 		/// <summary>
-		/// Sweeps a shape against the world using a specific profile
+		/// Sweeps a shape against the world using the query descriptor and retrieves the first blocking hit
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public static bool SweepTestByProfile(in Vector3 start, in Vector3 end, in Quaternion rotation, string profileName, in CollisionShape shape, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => sweepTestByProfile(start, end, rotation, profileName.StringToBytes(), shape, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		public static bool SweepSingle(int handle, in Vector3 start, in Vector3 end, in Quaternion rotation, in CollisionShape shape, ref Hit hit) => sweepSingle(handle, start, end, rotation, shape, ref hit);
 
 		/// <summary>
-		/// Sweeps a shape against the world using a specific profile and retrieves the first blocking hit
+		/// Sweeps a shape against the world using the query descriptor and retrieves all hits up to and including the first blocking hit to a span, only hits that fit into the span are retrieved
 		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool SweepSingleByChannel(in Vector3 start, in Vector3 end, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, ref Hit hit, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => sweepSingleByChannel(start, end, rotation, channel, shape, ref hit, null, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		/// <returns>The total number of hits, may exceed the length of the span</returns>
+		public static int SweepMulti(int handle, in Vector3 start, in Vector3 end, in Quaternion rotation, in CollisionShape shape, Span<Hit> hits) {
+			fixed (Hit* hitsPointer = hits) {
+				return sweepMulti(handle, start, end, rotation, shape, hitsPointer, hits.Length);
+			}
+		}
 
 		/// <summary>
-		/// Sweeps a shape against the world using a specific profile and retrieves the first blocking hit with a bone name
+		/// Tests a shape for any overlaps using the query descriptor
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public static bool SweepSingleByChannel(in Vector3 start, in Vector3 end, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, ref Hit hit, ref string boneName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
-			byte[] stringBuffer = ArrayPool.GetStringBuffer();
-
-			bool result = sweepSingleByChannel(start, end, rotation, channel, shape, ref hit, stringBuffer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
-
-			boneName = stringBuffer.BytesToString();
+		public static bool OverlapAnyTest(int handle, in Vector3 location, in Quaternion rotation, in CollisionShape shape) => overlapAnyTest(handle, location, rotation, shape);
 
-			return result;
+		/// <summary>
+		/// Retrieves components overlapping a shape using the query descriptor to a span, only components that fit into the span are retrieved
+		/// </summary>
+		/// <returns>The total number of overlapping components, may exceed the length of the span</returns>
+		public static int OverlapMulti(int handle, in Vector3 location, in Quaternion rotation, in CollisionShape shape, Span<ComponentReference> components) {
+			fixed (ComponentReference* componentsPointer = components) {
+				return overlapMulti(handle, location, rotation, shape, componentsPointer, components.Length);
+			}
 		}
 
 		/// <summary>
-		/// Sweeps a shape against the world using a specific profile and retrieves the first blocking hit
+		/// Traces a ray against the world using the query descriptor and retrieves only the requested fields of all hits up to and including the first blocking hit to a buffer, read the buffer with <see cref="CompactHits"/>
 		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool SweepSingleByProfile(in Vector3 start, in Vector3 end, in Quaternion rotation, string profileName, in CollisionShape shape, ref Hit hit, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => sweepSingleByProfile(start, end, rotation, profileName.StringToBytes(), shape, ref hit, null, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		/// <returns>The total number of hits, may exceed the number of hits that fit into the buffer</returns>
+		public static int LineTraceMultiCompact(int handle, in Vector3 start, in Vector3 end, HitFields fields, Span<byte> hits) {
+			int stride = CompactHits.GetStride(fields);
+
+			if (stride == 0)
+				throw new ArgumentOutOfRangeException(nameof(fields));
+
+			fixed (byte* hitsPointer = hits) {
+				return lineTraceMultiCompact(handle, start, end, fields, hitsPointer, hits.Length / stride);
+			}
+		}
 
 		/// <summary>
-		/// Sweeps a shape against the world using a specific profile and retrieves the first blocking hit with a bone name
+		/// Traces rays against the world using the query descriptor in a single call, sets a bit of the mask for each ray that hit anything and writes only the requested fields of the first blocking hit of each ray at the index of the ray, fields of rays that hit nothing are zeroed, read the buffer with <see cref="CompactHits"/>
 		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool SweepSingleByProfile(in Vector3 start, in Vector3 end, in Quaternion rotation, string profileName, in CollisionShape shape, ref Hit hit, ref string boneName, bool traceComplex = false, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) {
-			byte[] stringBuffer = ArrayPool.GetStringBuffer();
+		/// <returns>The number of rays that hit anything</returns>
+		public static int LineTraceBatchCompact(int handle, ReadOnlySpan<Vector3> starts, ReadOnlySpan<Vector3> ends, HitFields fields, Span<byte> hits, Span<byte> hitMask) {
+			int count = starts.Length;
 
-			bool result = sweepSingleByProfile(start, end, rotation, profileName.StringToBytes(), shape, ref hit, stringBuffer, traceComplex, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			if (ends.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(ends));
 
-			boneName = stringBuffer.BytesToString();
+			int stride = CompactHits.GetStride(fields);
 
-			return result;
+			if (stride == 0)
+				throw new ArgumentOutOfRangeException(nameof(fields));
+
+			if (hits.Length < stride * count)
+				throw new ArgumentOutOfRangeException(nameof(hits));
+
+			if (hitMask.Length < (count + 7) / 8)
+				throw new ArgumentOutOfRangeException(nameof(hitMask));
+
+			fixed (Vector3* startsPointer = starts) {
+				fixed (Vector3* endsPointer = ends) {
+					fixed (byte* hitsPointer = hits) {
+						fixed (byte* hitMaskPointer = hitMask) {
+							return lineTraceBatchCompact(handle, startsPointer, endsPointer, count, fields, hitsPointer, hitMaskPointer);
+						}
+					}
+				}
+			}
 		}
 
 		/// <summary>
-		/// Tests the collision shape at the specified location using a specific channel to determine if any blocking or overlapping occurred
+		/// Sweeps a shape against the world using the query descriptor and retrieves only the requested fields of all hits up to and including the first blocking hit to a buffer, read the buffer with <see cref="CompactHits"/>
 		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool OverlapAnyTestByChannel(in Vector3 location, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => overlapAnyTestByChannel(location, rotation, channel, shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		/// <returns>The total number of hits, may exceed the number of hits that fit into the buffer</returns>
+		public static int SweepMultiCompact(int handle, in Vector3 start, in Vector3 end, in Quaternion rotation, in CollisionShape shape, HitFields fields, Span<byte> hits) {
+			int stride = CompactHits.GetStride(fields);
 
-		/// <summary>
-		/// Tests the collision shape at the specified location using a specific profile to determine if any blocking or overlapping occurred
-		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool OverlapAnyTestByProfile(in Vector3 location, in Quaternion rotation, string profileName, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => overlapAnyTestByProfile(location, rotation, profileName.StringToBytes(), shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			if (stride == 0)
+				throw new ArgumentOutOfRangeException(nameof(fields));
 
-		/// <summary>
-		/// Tests the collision shape at the specified location using a specific channel to determine if any blocking occurred
-		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool OverlapBlockingTestByChannel(in Vector3 location, in Quaternion rotation, CollisionChannel channel, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => overlapBlockingTestByChannel(location, rotation, channel, shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+			fixed (byte* hitsPointer = hits) {
+				return sweepMultiCompact(handle, start, end, rotation, shape, fields, hitsPointer, hits.Length / stride);
+			}
+		}
 
 		/// <summary>
-		/// Tests the collision shape at the specified location using a specific profile to determine if any blocking occurred
+		/// Sweeps a shape against the world using the query descriptor in a single call, sets a bit of the mask for each sweep that hit anything and writes only the requested fields of the first blocking hit of each sweep at the index of the sweep, fields of sweeps that hit nothing are zeroed, read the buffer with <see cref="CompactHits"/>, the span of rotations may be empty to sweep without rotation
 		/// </summary>
-		/// <returns><c>true</c> on success</returns>
-		public static bool OverlapBlockingTestByProfile(in Vector3 location, in Quaternion rotation, string profileName, in CollisionShape shape, Actor ignoredActor = null, PrimitiveComponent ignoredComponent = null) => overlapBlockingTestByProfile(location, rotation, profileName.StringToBytes(), shape, ignoredActor != null ? ignoredActor.Pointer : IntPtr.Zero, ignoredComponent != null ? ignoredComponent.Pointer : IntPtr.Zero);
+		/// <returns>The number of sweeps that hit anything</returns>
+		public static int SweepBatchCompact(int handle, ReadOnlySpan<Vector3> starts, ReadOnlySpan<Vector3> ends, ReadOnlySpan<Quaternion> rotations, in CollisionShape shape, HitFields fields, Span<byte> hits, Span<byte> hitMask) {
+			int count = starts.Length;
+
+			if (ends.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(ends));
+
+			if (!rotations.IsEmpty && rotations.Length < count)
+				throw new ArgumentOutOfRangeException(nameof(rotations));
+
+			int stride = CompactHits.GetStride(fields);
+
+			if (stride == 0)
+				throw new ArgumentOutOfRangeException(nameof(fields));
+
+			if (hits.Length < stride * count)
+				throw new ArgumentOutOfRangeException(nameof(hits));
+
+			if (hitMask.Length < (count + 7) / 8)
+				throw new ArgumentOutOfRangeException(nameof(hitMask));
+
+			fixed (Vector3* startsPointer = starts) {
+				fixed (Vector3* endsPointer = ends) {
+					fixed (Quaternion* rotationsPointer = rotations) {
+						fixed (byte* hitsPointer = hits) {
+							fixed (byte* hitMaskPointer = hitMask) {
+								return sweepBatchCompact(handle, startsPointer, endsPointer, rotationsPointer, count, shape, fields, hitsPointer, hitMaskPointer);
+							}
+						}
+					}
+				}
+			}
+		}
 	}
 
 	/// <summary>
@@ -4701,6 +6401,7 @@ namespace UnrealEngine.Framework {
 	/// </summary>
 	public unsafe partial class Actor : IEquatable<Actor> {
 		private IntPtr pointer;
+		private ulong handle;
 
 		internal IntPtr Pointer {
 			get {
@@ -4715,6 +6416,9 @@ namespace UnrealEngine.Framework {
 					throw new InvalidOperationException();
 
 				pointer = value;
+
+				// The handle is acquired while the pointer is known to be valid, zero is returned if the table is full
+				handle = Handles.Acquire(value);
 			}
 		}
 
@@ -4739,10 +6443,90 @@ namespace UnrealEngine.Framework {
 			Pointer = spawn(name.StringToBytes(), Type, blueprint != null ? blueprint.Pointer : IntPtr.Zero);
 		}
 
+		/// <summary>
+		/// Spawns the actor at the transform without running its construction, components and properties can be set up before <see cref="FinishSpawning()"/> is called
+		/// </summary>
+		/// <param name="transform">The transform of the actor in world space</param>
+		/// <param name="name">The name of the actor</param>
+		/// <param name="blueprint">The blueprint class to use as a base class, should be equal to the exact type of the actor</param>
+		/// <typeparam name="T">The type of the actor</typeparam>
+		/// <returns>An actor or <c>null</c> on failure</returns>
+		public static T SpawnDeferred<T>(in Transform transform, string name = null, Blueprint blueprint = null) where T : Actor {
+			T actor = FormatterServices.GetUninitializedObject(typeof(T)) as T;
+
+			if (name?.Length == 0)
+				name = null;
+
+			if (blueprint != null && !blueprint.IsValidClass(actor.Type))
+				throw new InvalidOperationException();
+
+			IntPtr pointer = spawnDeferred(name.StringToBytes(), actor.Type, blueprint != null ? blueprint.Pointer : IntPtr.Zero, transform);
+
+			if (pointer != IntPtr.Zero) {
+				actor.Pointer = pointer;
+
+				return actor;
+			}
+
+			return null;
+		}
+
+		/// <summary>
+		/// Spawns actors at the transforms in a single call
+		/// </summary>
+		/// <param name="transforms">The transforms of the actors in world space</param>
+		/// <param name="actors">The spawned actors, failed spawns are left empty</param>
+		/// <param name="deferred">If <c>true</c>, construction of the actors is deferred until <see cref="FinishSpawning(ReadOnlySpan{ActorReference})"/> is called</param>
+		/// <param name="blueprint">The blueprint class to use as a base class, should be equal to the exact type of the actors</param>
+		/// <typeparam name="T">The type of the actors</typeparam>
+		/// <returns>The number of spawned actors</returns>
+		public static int SpawnBatch<T>(ReadOnlySpan<Transform> transforms, Span<ActorReference> actors, bool deferred = false, Blueprint blueprint = null) where T : Actor {
+			if (actors.Length < transforms.Length)
+				throw new ArgumentOutOfRangeException(nameof(actors));
+
+			ActorType type = (FormatterServices.GetUninitializedObject(typeof(T)) as T).Type;
+
+			if (blueprint != null && !blueprint.IsValidClass(type))
+				throw new InvalidOperationException();
+
+			fixed (Transform* transformsPointer = transforms) {
+				fixed (ActorReference* actorsPointer = actors) {
+					return spawnBatch(type, blueprint != null ? blueprint.Pointer : IntPtr.Zero, transformsPointer, transforms.Length, deferred, actorsPointer);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Finishes spawning of the actors spawned with deferred construction in a single call
+		/// </summary>
+		/// <returns>The number of actors that finished spawning</returns>
+		public static int FinishSpawning(ReadOnlySpan<ActorReference> actors) {
+			fixed (ActorReference* actorsPointer = actors) {
+				return finishSpawningBatch(actorsPointer, actors.Length);
+			}
+		}
+
+		/// <summary>
+		/// Finishes spawning of the actor spawned with deferred construction and runs its construction
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool FinishSpawning() => finishSpawning(Pointer);
+
 		/// <summary>
 		/// Returns <c>true</c> if the actor is spawned
 		/// </summary>
-		public bool IsSpawned => pointer != IntPtr.Zero && !isPendingKill(pointer);
+		public bool IsSpawned {
+			get {
+				if (pointer == IntPtr.Zero)
+					return false;
+
+				// The generation is bumped once the actor is destroyed, so the table alone tells whether the actor is alive without calling into the engine
+				if (handle != 0)
+					return Handles.IsAlive(handle);
+
+				return !isPendingKill(pointer);
+			}
+		}
 
 		/// <summary>
 		/// Returns <c>true</c> if the root component is <see cref="ComponentMobility.Movable"/>
@@ -5405,9 +7189,9 @@ namespace UnrealEngine.Framework {
 		public bool HasTag(string tag) => hasTag(Pointer, tag.StringToBytes());
 
 		/// <summary>
-		/// Registers an event notification for the actor
+		/// Registers an event notification for the actor, hit events are filtered per colliding pair using the specified filter, where the value is a rate per second or an impulse threshold
 		/// </summary>
-		public void RegisterEvent(ActorEventType type) => registerEvent(Pointer, type);
+		public void RegisterEvent(ActorEventType type, HitFilter filter = HitFilter.None, float filterValue = 0.0f) => registerEvent(Pointer, type, filter, filterValue);
 
 		/// <summary>
 		/// Unregisters an event notification for the actor
@@ -7677,6 +9461,9 @@ namespace UnrealEngine.Framework {
 
 		internal virtual ComponentType Type => ComponentType.Actor;
 
+		// Skips the validation for bulk operations where the engine validates the components itself
+		internal IntPtr UncheckedPointer => pointer;
+
 		private protected ActorComponent() { }
 
 		internal ActorComponent(IntPtr pointer) => Pointer = pointer;
@@ -8786,6 +10573,115 @@ namespace UnrealEngine.Framework {
 		/// Sets the transform of the component in world space
 		/// </summary>
 		public void SetWorldTransform(in Transform transform) => setWorldTransform(Pointer, transform);
+
+		/// <summary>
+		/// Retrieves transforms of the components in world space to a span in a single call, values of invalid components are set to the identity transform
+		/// </summary>
+		public static void GetTransforms(ReadOnlySpan<SceneComponent> components, Span<Transform> values) {
+			if (values.Length < components.Length)
+				throw new ArgumentOutOfRangeException(nameof(values));
+
+			fixed (IntPtr* componentsPointer = GetPointers(components)) {
+				fixed (Transform* valuesPointer = values) {
+					getComponentTransforms(componentsPointer, components.Length, valuesPointer);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Retrieves locations of the components in world space to a span in a single call, values of invalid components are set to zero
+		/// </summary>
+		public static void GetLocations(ReadOnlySpan<SceneComponent> components, Span<Vector3> values) {
+			if (values.Length < components.Length)
+				throw new ArgumentOutOfRangeException(nameof(values));
+
+			fixed (IntPtr* componentsPointer = GetPointers(components)) {
+				fixed (Vector3* valuesPointer = values) {
+					getComponentLocations(componentsPointer, components.Length, valuesPointer);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Retrieves locations of the components in world space to separate spans of coordinates in a single call, values of invalid components are set to zero
+		/// </summary>
+		public static void GetLocations(ReadOnlySpan<SceneComponent> components, Span<float> x, Span<float> y, Span<float> z) {
+			if (x.Length < components.Length)
+				throw new ArgumentOutOfRangeException(nameof(x));
+
+			if (y.Length < components.Length)
+				throw new ArgumentOutOfRangeException(nameof(y));
+
+			if (z.Length < components.Length)
+				throw new ArgumentOutOfRangeException(nameof(z));
+
+			fixed (IntPtr* componentsPointer = GetPointers(components)) {
+				fixed (float* xPointer = x, yPointer = y, zPointer = z) {
+					getComponentLocationsSeparated(componentsPointer, components.Length, xPointer, yPointer, zPointer);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Sets transforms of the components in world space in a single call, each component defers its own overlap and attached transform updates until all components are moved, updates are not merged across components
+		/// </summary>
+		/// <param name="components">The components to move, invalid components are skipped</param>
+		/// <param name="transforms">The transforms of the components</param>
+		/// <param name="teleport">If <c>true</c>, physics velocity of the components remains unchanged</param>
+		public static void SetWorldTransforms(ReadOnlySpan<SceneComponent> components, ReadOnlySpan<Transform> transforms, bool teleport = false) {
+			if (transforms.Length < components.Length)
+				throw new ArgumentOutOfRangeException(nameof(transforms));
+
+			fixed (IntPtr* componentsPointer = GetPointers(components)) {
+				fixed (Transform* transformsPointer = transforms) {
+					setWorldTransforms(componentsPointer, components.Length, transformsPointer, teleport);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Sets locations of the components in world space in a single call, each component defers its own overlap and attached transform updates until all components are moved, updates are not merged across components
+		/// </summary>
+		/// <param name="components">The components to move, invalid components are skipped</param>
+		/// <param name="locations">The locations of the components</param>
+		/// <param name="teleport">If <c>true</c>, physics velocity of the components remains unchanged</param>
+		public static void SetWorldLocations(ReadOnlySpan<SceneComponent> components, ReadOnlySpan<Vector3> locations, bool teleport = false) {
+			if (locations.Length < components.Length)
+				throw new ArgumentOutOfRangeException(nameof(locations));
+
+			fixed (IntPtr* componentsPointer = GetPointers(components)) {
+				fixed (Vector3* locationsPointer = locations) {
+					setWorldLocations(componentsPointer, components.Length, locationsPointer, teleport);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Sets transforms of the components relative to their parents in a single call, each component defers its own overlap and attached transform updates until all components are moved, updates are not merged across components
+		/// </summary>
+		/// <param name="components">The components to move, invalid components are skipped</param>
+		/// <param name="transforms">The relative transforms of the components</param>
+		/// <param name="teleport">If <c>true</c>, physics velocity of the components remains unchanged</param>
+		public static void SetRelativeTransforms(ReadOnlySpan<SceneComponent> components, ReadOnlySpan<Transform> transforms, bool teleport = false) {
+			if (transforms.Length < components.Length)
+				throw new ArgumentOutOfRangeException(nameof(transforms));
+
+			fixed (IntPtr* componentsPointer = GetPointers(components)) {
+				fixed (Transform* transformsPointer = transforms) {
+					setRelativeTransforms(componentsPointer, components.Length, transformsPointer, teleport);
+				}
+			}
+		}
+
+		private static IntPtr[] GetPointers(ReadOnlySpan<SceneComponent> components) {
+			IntPtr[] pointers = ArrayPool.GetPointerBuffer(components.Length);
+
+			for (int i = 0; i < components.Length; i++) {
+				pointers[i] = components[i] != null ? components[i].UncheckedPointer : IntPtr.Zero;
+			}
+
+			return pointers;
+		}
 	}
 
 	/// <summary>
@@ -9773,9 +11669,9 @@ namespace UnrealEngine.Framework {
 		}
 
 		/// <summary>
-		/// Registers an event notification for the primitive component
+		/// Registers an event notification for the primitive component, hit events are filtered per colliding pair using the specified filter, where the value is a rate per second or an impulse threshold
 		/// </summary>
-		public void RegisterEvent(ComponentEventType type) => registerEvent(Pointer, type);
+		public void RegisterEvent(ComponentEventType type, HitFilter filter = HitFilter.None, float filterValue = 0.0f) => registerEvent(Pointer, type, filter, filterValue);
 
 		/// <summary>
 		/// Unregisters an event notification for the primitive component
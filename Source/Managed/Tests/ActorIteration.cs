@@ -0,0 +1,69 @@
+namespace UnrealEngine.Tests {
+	public class ActorIteration : ISystem {
+		private const string iterationTag = "IteratedActor";
+		private const int actorsCount = 300;
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			// More actors than the internal chunk of the iteration to continue from the cursor at least once
+			for (int i = 0; i < actorsCount; i++) {
+				Actor actor = new();
+
+				actor.AddTag(iterationTag);
+			}
+
+			TestForEach();
+			TestCursor();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Actor iteration tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private static void TestForEach() {
+			int taggedActors = 0;
+			int cameras = 0;
+
+			World.ForEachActor<Actor>(actor => {
+				if (actor.HasTag(iterationTag))
+					taggedActors++;
+			});
+
+			World.ForEachActor<Camera>(camera => cameras++);
+
+			Assert.IsTrue(taggedActors == actorsCount);
+			Assert.IsTrue(cameras > 0);
+
+			Span<ActorReference> actors = stackalloc ActorReference[1];
+
+			Assert.IsTrue(World.GetActors<Actor>(actors) >= actorsCount);
+			Assert.IsTrue(World.GetActors<Camera>(actors) == cameras);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Actors iterated in chunks and filtered by class!");
+		}
+
+		private static void TestCursor() {
+			Span<ActorReference> actors = stackalloc ActorReference[64];
+			long cursor = 0;
+			int elements;
+			int taggedActors = 0;
+			int chunks = 0;
+
+			do {
+				elements = World.GetActors<Actor>(actors, ref cursor);
+				chunks++;
+
+				for (int i = 0; i < elements; i++) {
+					if (actors[i].ToActor<Actor>().HasTag(iterationTag))
+						taggedActors++;
+				}
+			} while (elements == actors.Length);
+
+			Assert.IsTrue(taggedActors == actorsCount);
+			Assert.IsTrue(chunks > actorsCount / actors.Length);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Actors retrieved from the cursor without repetition!");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+namespace UnrealEngine.Tests {
+	public class ActorLookup : ISystem {
+		private const string lookupTag = "LookupActor";
+		private const int taggedActors = 3;
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			TestNames();
+			TestTags();
+			TestIDs();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Actor lookup tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private static void TestNames() {
+			Actor actor = new("OriginalActor");
+
+			Assert.IsTrue(actor.Equals(World.GetActor<Actor>("OriginalActor")));
+
+			actor.Rename("RenamedActor");
+
+			Assert.IsNull(World.GetActor<Actor>("OriginalActor"));
+			Assert.IsTrue(actor.Equals(World.GetActor<Actor>("RenamedActor")));
+			Assert.IsNull(World.GetActor<Camera>("RenamedActor"));
+
+			actor.Destroy();
+
+			Assert.IsNull(World.GetActor<Actor>("RenamedActor"));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Renamed actor found by its new name only!");
+		}
+
+		private static void TestTags() {
+			Actor[] actors = new Actor[taggedActors];
+
+			for (int i = 0; i < actors.Length; i++) {
+				actors[i] = new();
+				actors[i].AddTag(lookupTag);
+			}
+
+			Assert.IsNotNull(World.GetActorByTag<Actor>(lookupTag));
+			Assert.IsTrue(World.GetActorsByTag<Actor>(lookupTag).Length == taggedActors);
+
+			actors[0].RemoveTag(lookupTag);
+			actors[1].Destroy();
+
+			Actor[] remainingActors = World.GetActorsByTag<Actor>(lookupTag);
+
+			Assert.IsTrue(remainingActors.Length == 1);
+			Assert.IsTrue(actors[2].Equals(remainingActors[0]));
+			Assert.IsTrue(actors[2].Equals(World.GetActorByTag<Actor>(lookupTag)));
+			Assert.IsNull(World.GetActorByTag<Actor>("MissingTag"));
+			Assert.IsTrue(World.GetActorsByTag<Actor>("MissingTag").Length == 0);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Tagged actors found after tag changes!");
+		}
+
+		private static void TestIDs() {
+			Actor actor = new("IdentifiedActor");
+			uint id = actor.ID;
+
+			Assert.IsTrue(actor.Equals(World.GetActorByID<Actor>(id)));
+			Assert.IsNull(World.GetActorByID<Camera>(id));
+
+			actor.Destroy();
+
+			Assert.IsNull(World.GetActorByID<Actor>(id));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Actor found by its unique ID!");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+namespace UnrealEngine.Tests {
+	public class ActorPooling : ISystem {
+		private const string pooledTag = "PooledActor";
+		private static readonly Vector3 releaseLocation = new(0.0f, 600.0f, 0.0f);
+		private static readonly Vector3 acquireLocation = new(0.0f, 900.0f, 0.0f);
+		private Actor mirroredActor;
+		private int mirroredSlot;
+		private int frame;
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			TestReuse();
+			TestPrewarm();
+
+			mirroredActor = new();
+			mirroredSlot = Mirror.Add(mirroredActor);
+
+			Assert.IsTrue(mirroredSlot >= 0);
+			Assert.IsTrue(ActorPool.Release(mirroredActor));
+		}
+
+		public void OnTick(float deltaTime) {
+			frame++;
+
+			// States are captured at the end of each frame, so the first complete capture is read in the second frame
+			if (frame == 2) {
+				Assert.IsFalse(Mirror.States[mirroredSlot].IsValid);
+
+				Actor acquiredActor = ActorPool.Acquire<Actor>(new(acquireLocation, Quaternion.Identity, Vector3.One));
+
+				Assert.IsTrue(mirroredActor.Equals(acquiredActor));
+
+				// The mirror registration is restored on acquisition, possibly in another slot which is returned by registering again
+				mirroredSlot = Mirror.Add(mirroredActor);
+
+				Assert.IsTrue(mirroredSlot >= 0);
+			} else if (frame == 3) {
+				ActorState state = Mirror.States[mirroredSlot];
+
+				Assert.IsTrue(state.IsValid);
+				Assert.IsTrue(Vector3.Distance(state.Location, acquireLocation) < 1.0f);
+				Assert.IsTrue(Mirror.Remove(mirroredActor));
+
+				Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Actor pooling tests completed!");
+			}
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private static void TestReuse() {
+			Vector3 traceOffset = new(0.0f, -200.0f, 0.0f);
+			Actor actor = new("PooledActor");
+			StaticMeshComponent staticMeshComponent = new(actor, setAsRoot: true);
+
+			staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+			staticMeshComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+			staticMeshComponent.SetWorldLocation(releaseLocation);
+
+			actor.AddTag(pooledTag);
+			actor.SetEnableCollision(false);
+
+			Assert.IsTrue(SpatialHash.Add(actor));
+			Assert.IsTrue(ActorPool.Release(actor));
+			Assert.IsFalse(ActorPool.Release(actor));
+			Assert.IsNull(World.GetActor<Actor>("PooledActor"));
+			Assert.IsNull(World.GetActorByTag<Actor>(pooledTag));
+
+			Span<ActorReference> actors = stackalloc ActorReference[4];
+
+			Assert.IsTrue(SpatialHash.QueryRadius(releaseLocation, 100.0f, actors) == 0);
+
+			Actor acquiredActor = ActorPool.Acquire<Actor>(new(acquireLocation, Quaternion.Identity, Vector3.One));
+
+			Assert.IsTrue(actor.Equals(acquiredActor));
+			Assert.IsTrue(actor.Equals(World.GetActor<Actor>("PooledActor")));
+			Assert.IsTrue(actor.Equals(World.GetActorByTag<Actor>(pooledTag)));
+			Assert.IsTrue(SpatialHash.QueryRadius(acquireLocation, 100.0f, actors) == 1);
+			Assert.IsTrue(actor.Equals(actors[0].ToActor<Actor>()));
+
+			// Collision was disabled before the release and stays disabled after the acquisition
+			Assert.IsFalse(World.LineTraceTestByChannel(acquireLocation + traceOffset, acquireLocation, CollisionChannel.WorldStatic));
+
+			actor.SetEnableCollision(true);
+
+			Assert.IsTrue(World.LineTraceTestByChannel(acquireLocation + traceOffset, acquireLocation, CollisionChannel.WorldStatic));
+			Assert.IsTrue(SpatialHash.Remove(actor));
+			Assert.IsTrue(actor.Destroy());
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Pooled actor reused with its state restored!");
+		}
+
+		private static void TestPrewarm() {
+			Actor actor = new();
+
+			ActorPool.Prewarm<Actor>(2);
+
+			Actor prewarmedActor = ActorPool.Acquire<Actor>(new(releaseLocation, Quaternion.Identity, Vector3.One));
+
+			Assert.IsNotNull(prewarmedActor);
+			Assert.IsTrue(prewarmedActor.IsSpawned);
+			Assert.IsFalse(actor.Equals(prewarmedActor));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Prewarmed actor acquired from the pool!");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+namespace UnrealEngine.Tests {
+	public class AsyncQueries : ISystem {
+		private Actor blockingActor;
+		private uint singleTicket;
+		private uint multiTicket;
+		private uint sweepTicket;
+		private uint overlapTicket;
+		private uint missTicket;
+		private int singleResults;
+		private int multiResults;
+		private int sweepResults;
+		private int overlapResults;
+		private int missResults;
+		private int frame;
+		private static readonly Vector3 traceStart = new(0.0f, 0.0f, 0.0f);
+		private static readonly Vector3 traceEnd = new(0.0f, 900.0f, 0.0f);
+		private static readonly Vector3 overlappingLocation = new(0.0f, 300.0f, 0.0f);
+		private static readonly Vector3 blockingLocation = new(0.0f, 600.0f, 0.0f);
+		private static readonly Vector3 missOffset = new(1000.0f, 0.0f, 0.0f);
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			Actor overlappingActor = new("OverlappingBox");
+			StaticMeshComponent overlappingComponent = new(overlappingActor, setAsRoot: true);
+
+			overlappingComponent.SetStaticMesh(StaticMesh.Cube);
+			overlappingComponent.SetWorldLocation(overlappingLocation);
+			overlappingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+			overlappingComponent.SetCollisionResponseToChannel(CollisionChannel.WorldStatic, CollisionResponse.Overlap);
+
+			blockingActor = new("BlockingBox");
+
+			StaticMeshComponent blockingComponent = new(blockingActor, setAsRoot: true);
+
+			blockingComponent.SetStaticMesh(StaticMesh.Cube);
+			blockingComponent.SetWorldLocation(blockingLocation);
+			blockingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+
+			World.SetOnAsyncQueriesCallback(OnAsyncQueries);
+
+			singleTicket = World.AsyncLineTraceByChannel(traceStart, traceEnd, CollisionChannel.WorldStatic);
+			multiTicket = World.AsyncLineTraceByChannel(traceStart, traceEnd, CollisionChannel.WorldStatic, multi: true);
+			sweepTicket = World.AsyncSweepByChannel(traceStart, traceEnd, Quaternion.Identity, CollisionChannel.WorldStatic, CollisionShape.CreateSphere(25.0f));
+			overlapTicket = World.AsyncOverlapByChannel((overlappingLocation + blockingLocation) * 0.5f, Quaternion.Identity, CollisionChannel.WorldStatic, CollisionShape.CreateBox(new(60.0f, 250.0f, 60.0f)));
+			missTicket = World.AsyncLineTraceByChannel(traceStart + missOffset, traceEnd + missOffset, CollisionChannel.WorldStatic);
+
+			uint[] tickets = { singleTicket, multiTicket, sweepTicket, overlapTicket, missTicket };
+
+			for (int i = 0; i < tickets.Length; i++) {
+				for (int j = i + 1; j < tickets.Length; j++) {
+					Assert.IsTrue(tickets[i] != tickets[j]);
+				}
+			}
+		}
+
+		public void OnTick(float deltaTime) {
+			frame++;
+
+			// Results of asynchronous queries are delivered in the frame after they were issued
+			if (frame == 3) {
+				Assert.IsTrue(singleResults == 1);
+				Assert.IsTrue(multiResults == 2);
+				Assert.IsTrue(sweepResults == 1);
+				Assert.IsTrue(overlapResults >= 2);
+				Assert.IsTrue(missResults == 1);
+
+				Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Asynchronous queries tests completed!");
+			}
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private void OnAsyncQueries(ReadOnlySpan<AsyncQueryResult> results) {
+			foreach (AsyncQueryResult result in results) {
+				if (result.Ticket == singleTicket) {
+					singleResults++;
+
+					Assert.IsTrue(blockingActor.Equals(result.Hit.GetActor()));
+				} else if (result.Ticket == multiTicket) {
+					multiResults++;
+				} else if (result.Ticket == sweepTicket) {
+					sweepResults++;
+
+					Assert.IsTrue(blockingActor.Equals(result.Hit.GetActor()));
+				} else if (result.Ticket == overlapTicket) {
+					overlapResults++;
+				} else if (result.Ticket == missTicket) {
+					missResults++;
+
+					// A query without hits produces a single result without an actor
+					Assert.IsNull(result.Hit.GetActor());
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+namespace UnrealEngine.Tests {
+	public class BatchedQueries : ISystem {
+		private Actor blockingActor;
+		private const int queriesCount = 10;
+		private static readonly Vector3 traceStart = new(0.0f, 0.0f, 0.0f);
+		private static readonly Vector3 traceEnd = new(0.0f, 900.0f, 0.0f);
+		private static readonly Vector3 missOffset = new(1000.0f, 0.0f, 0.0f);
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			Actor overlappingActor = new("OverlappingBox");
+			StaticMeshComponent overlappingComponent = new(overlappingActor, setAsRoot: true);
+
+			overlappingComponent.SetStaticMesh(StaticMesh.Cube);
+			overlappingComponent.SetWorldLocation(new(0.0f, 300.0f, 0.0f));
+			overlappingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+			overlappingComponent.SetCollisionResponseToChannel(CollisionChannel.WorldStatic, CollisionResponse.Overlap);
+
+			blockingActor = new("BlockingBox");
+
+			StaticMeshComponent blockingComponent = new(blockingActor, setAsRoot: true);
+
+			blockingComponent.SetStaticMesh(StaticMesh.Cube);
+			blockingComponent.SetWorldLocation(new(0.0f, 600.0f, 0.0f));
+			blockingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+
+			TestLineTraces();
+			TestSweeps();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Batched queries tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private void TestLineTraces() {
+			Span<Vector3> starts = stackalloc Vector3[queriesCount];
+			Span<Vector3> ends = stackalloc Vector3[queriesCount];
+			Span<Hit> hits = new Hit[queriesCount];
+			Span<byte> hitMask = stackalloc byte[(queriesCount + 7) / 8];
+
+			SetQueries(starts, ends);
+
+			// Even queries hit the blocking box and odd ones miss, the mask spans more than a byte
+			Assert.IsTrue(World.LineTraceBatchByChannel(starts, ends, CollisionChannel.WorldStatic, hits, hitMask) == queriesCount / 2);
+			Assert.IsTrue(hitMask[0] == 0b01010101);
+			Assert.IsTrue(hitMask[1] == 0b01);
+
+			for (int i = 0; i < queriesCount; i += 2) {
+				Assert.IsTrue(hits[i].BlockingHit);
+				Assert.IsTrue(blockingActor.Equals(hits[i].GetActor()));
+			}
+
+			hitMask.Clear();
+
+			Assert.IsTrue(World.LineTraceBatchByChannel(starts, ends, CollisionChannel.WorldStatic, hitMask, ignoredActor: blockingActor) == 0);
+			Assert.IsTrue(hitMask[0] == 0 && hitMask[1] == 0);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Batched line traces marked the hits!");
+		}
+
+		private void TestSweeps() {
+			Span<Vector3> starts = stackalloc Vector3[queriesCount];
+			Span<Vector3> ends = stackalloc Vector3[queriesCount];
+			Span<Quaternion> rotations = stackalloc Quaternion[queriesCount];
+			Span<Hit> hits = new Hit[queriesCount];
+			Span<byte> hitMask = stackalloc byte[(queriesCount + 7) / 8];
+
+			SetQueries(starts, ends);
+			rotations.Fill(Quaternion.Identity);
+
+			Assert.IsTrue(World.SweepBatchByChannel(starts, ends, rotations, CollisionChannel.WorldStatic, CollisionShape.CreateSphere(25.0f), hits, hitMask) == queriesCount / 2);
+			Assert.IsTrue(hitMask[0] == 0b01010101);
+			Assert.IsTrue(hitMask[1] == 0b01);
+			Assert.IsTrue(blockingActor.Equals(hits[0].GetActor()));
+
+			// Identity rotations are used for an empty span
+			Assert.IsTrue(World.SweepBatchByChannel(starts, ends, ReadOnlySpan<Quaternion>.Empty, CollisionChannel.WorldStatic, CollisionShape.CreateSphere(25.0f), hitMask) == queriesCount / 2);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Batched sweeps marked the hits!");
+		}
+
+		private static void SetQueries(Span<Vector3> starts, Span<Vector3> ends) {
+			for (int i = 0; i < starts.Length; i++) {
+				Vector3 offset = i % 2 == 0 ? Vector3.Zero : missOffset;
+
+				starts[i] = traceStart + offset;
+				ends[i] = traceEnd + offset;
+			}
+		}
+	}
+}
\ No newline at end of file
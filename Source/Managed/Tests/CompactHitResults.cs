@@ -0,0 +1,152 @@
+namespace UnrealEngine.Tests {
+	public class CompactHitResults : ISystem {
+		private Actor blockingActor;
+		private int query;
+		private const HitFields fields = HitFields.Actor | HitFields.Location | HitFields.Distance | HitFields.Flags;
+		private static readonly Vector3 traceStart = new(0.0f, 0.0f, 0.0f);
+		private static readonly Vector3 traceEnd = new(0.0f, 900.0f, 0.0f);
+		private static readonly Vector3 missOffset = new(1000.0f, 0.0f, 0.0f);
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			Actor overlappingActor = new("OverlappingBox");
+			StaticMeshComponent overlappingComponent = new(overlappingActor, setAsRoot: true);
+
+			overlappingComponent.SetStaticMesh(StaticMesh.Cube);
+			overlappingComponent.SetWorldLocation(new(0.0f, 300.0f, 0.0f));
+			overlappingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+			overlappingComponent.SetCollisionResponseToChannel(CollisionChannel.WorldStatic, CollisionResponse.Overlap);
+
+			blockingActor = new("BlockingBox");
+
+			StaticMeshComponent blockingComponent = new(blockingActor, setAsRoot: true);
+
+			blockingComponent.SetStaticMesh(StaticMesh.Cube);
+			blockingComponent.SetWorldLocation(new(0.0f, 600.0f, 0.0f));
+			blockingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+
+			query = CollisionQuery.Create(CollisionChannel.WorldStatic);
+
+			Assert.IsTrue(query != -1);
+
+			TestMultiHits();
+			TestBatches();
+			TestEmptyFields();
+
+			Assert.IsTrue(CollisionQuery.Destroy(query));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Compact hit results tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private void TestMultiHits() {
+			int stride = CompactHits.GetStride(fields);
+			Span<byte> buffer = new byte[stride * 4];
+			Span<Hit> hits = new Hit[4];
+			int hitCount = CollisionQuery.LineTraceMultiCompact(query, traceStart, traceEnd, fields, buffer);
+
+			Assert.IsTrue(hitCount == 2);
+			Assert.IsTrue(CollisionQuery.LineTraceMulti(query, traceStart, traceEnd, hits) == 2);
+
+			CompactHits compactHits = new(buffer[..(hitCount * stride)], fields);
+
+			Assert.IsTrue(compactHits.Length == 2);
+			Assert.IsTrue(compactHits.Stride == stride);
+			Assert.IsFalse(compactHits.IsBlockingHit(0));
+			Assert.IsTrue(compactHits.IsBlockingHit(1));
+			Assert.IsTrue(blockingActor.Equals(compactHits.GetActor(1).ToActor<Actor>()));
+			Assert.IsTrue(Vector3.Distance(compactHits.GetLocation(1), hits[1].Location) < 1.0f);
+			Assert.IsTrue(Math.Abs(compactHits.GetDistance(1) - hits[1].Distance) < 1.0f);
+
+			// Only hits that fit into the buffer are written, the total number is returned
+			Assert.IsTrue(CollisionQuery.SweepMultiCompact(query, traceStart, traceEnd, Quaternion.Identity, CollisionShape.CreateSphere(25.0f), fields, buffer[..stride]) == 2);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Compact hits matched the full hits!");
+		}
+
+		private void TestBatches() {
+			int stride = CompactHits.GetStride(fields);
+			ReadOnlySpan<Vector3> starts = new Vector3[] { traceStart, traceStart + missOffset };
+			ReadOnlySpan<Vector3> ends = new Vector3[] { traceEnd, traceEnd + missOffset };
+			Span<byte> buffer = new byte[stride * starts.Length];
+			Span<byte> hitMask = stackalloc byte[1];
+
+			// The buffer is prefilled to ensure that slots of queries that hit nothing are zeroed
+			buffer.Fill(0xFF);
+
+			Assert.IsTrue(CollisionQuery.LineTraceBatchCompact(query, starts, ends, fields, buffer, hitMask) == 1);
+			Assert.IsTrue(hitMask[0] == 0b01);
+
+			CompactHits compactHits = new(buffer, fields);
+
+			Assert.IsTrue(compactHits.IsBlockingHit(0));
+			Assert.IsTrue(blockingActor.Equals(compactHits.GetActor(0).ToActor<Actor>()));
+			Assert.IsFalse(compactHits.IsBlockingHit(1));
+			Assert.IsFalse(compactHits.GetActor(1).IsSpawned);
+			Assert.IsTrue(compactHits.GetLocation(1) == Vector3.Zero);
+			Assert.IsTrue(compactHits.GetDistance(1) == 0.0f);
+
+			buffer.Fill(0xFF);
+			hitMask.Clear();
+
+			Assert.IsTrue(CollisionQuery.SweepBatchCompact(query, starts, ends, ReadOnlySpan<Quaternion>.Empty, CollisionShape.CreateSphere(25.0f), fields, buffer, hitMask) == 1);
+			Assert.IsTrue(hitMask[0] == 0b01);
+
+			compactHits = new(buffer, fields);
+
+			Assert.IsTrue(blockingActor.Equals(compactHits.GetActor(0).ToActor<Actor>()));
+			Assert.IsFalse(compactHits.GetActor(1).IsSpawned);
+			Assert.IsTrue(compactHits.GetLocation(1) == Vector3.Zero);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Compact batches zeroed the missed slots!");
+		}
+
+		private void TestEmptyFields() {
+			ReadOnlySpan<Vector3> starts = new Vector3[] { traceStart };
+			ReadOnlySpan<Vector3> ends = new Vector3[] { traceEnd };
+			Span<byte> buffer = new byte[64];
+			Span<byte> hitMask = stackalloc byte[1];
+			ushort exceptions = 0;
+
+			Assert.IsTrue(CompactHits.GetStride(HitFields.None) == 0);
+
+			try {
+				CollisionQuery.LineTraceMultiCompact(query, traceStart, traceEnd, HitFields.None, buffer);
+			}
+
+			catch (ArgumentOutOfRangeException) {
+				exceptions++;
+			}
+
+			try {
+				CollisionQuery.LineTraceBatchCompact(query, starts, ends, HitFields.None, buffer, hitMask);
+			}
+
+			catch (ArgumentOutOfRangeException) {
+				exceptions++;
+			}
+
+			try {
+				CollisionQuery.SweepMultiCompact(query, traceStart, traceEnd, Quaternion.Identity, CollisionShape.CreateSphere(25.0f), HitFields.None, buffer);
+			}
+
+			catch (ArgumentOutOfRangeException) {
+				exceptions++;
+			}
+
+			try {
+				CollisionQuery.SweepBatchCompact(query, starts, ends, ReadOnlySpan<Quaternion>.Empty, CollisionShape.CreateSphere(25.0f), HitFields.None, buffer, hitMask);
+			}
+
+			catch (ArgumentOutOfRangeException) {
+				exceptions++;
+			}
+
+			Assert.IsTrue(exceptions == 4);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Compact queries without fields rejected!");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+namespace UnrealEngine.Tests {
+	public class DeferredSpawning : ISystem {
+		private const string batchTag = "BatchActor";
+		private const int batchSize = 4;
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			TestDeferredSpawn();
+			TestBatchSpawn();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Deferred spawning tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private static void TestDeferredSpawn() {
+			Vector3 location = new(0.0f, -300.0f, 0.0f);
+			Actor actor = Actor.SpawnDeferred<Actor>(new(location, Quaternion.Identity, Vector3.One), "DeferredActor");
+
+			Assert.IsNotNull(actor);
+
+			StaticMeshComponent staticMeshComponent = new(actor, setAsRoot: true);
+
+			staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+
+			Assert.IsTrue(actor.FinishSpawning());
+			Assert.IsFalse(actor.FinishSpawning());
+			Assert.IsTrue(actor.Equals(World.GetActor<Actor>("DeferredActor")));
+			Assert.IsTrue(Vector3.Distance(staticMeshComponent.GetLocation(), location) < 1.0f);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Deferred actor finished spawning at its transform!");
+		}
+
+		private static void TestBatchSpawn() {
+			Span<Transform> transforms = stackalloc Transform[batchSize];
+			Span<ActorReference> actors = stackalloc ActorReference[batchSize];
+
+			for (int i = 0; i < batchSize; i++) {
+				transforms[i] = new(new(200.0f * i, -600.0f, 0.0f), Quaternion.Identity, Vector3.One);
+			}
+
+			Assert.IsTrue(Actor.SpawnBatch<Actor>(transforms, actors, deferred: true) == batchSize);
+			Assert.IsTrue(Actor.FinishSpawning(actors) == batchSize);
+			Assert.IsTrue(Actor.FinishSpawning(actors) == 0);
+
+			for (int i = 0; i < batchSize; i++) {
+				Assert.IsTrue(actors[i].IsSpawned);
+
+				actors[i].ToActor<Actor>().AddTag(batchTag);
+			}
+
+			Assert.IsTrue(World.GetActorsByTag<Actor>(batchTag).Length == batchSize);
+
+			// Actors spawned without deferred construction are finished by the batch itself
+			Assert.IsTrue(Actor.SpawnBatch<Actor>(transforms, actors) == batchSize);
+			Assert.IsTrue(Actor.FinishSpawning(actors) == 0);
+
+			for (int i = 0; i < batchSize; i++) {
+				Assert.IsTrue(actors[i].IsSpawned);
+			}
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Batches of actors spawned!");
+		}
+	}
+}
\ No newline at end of file
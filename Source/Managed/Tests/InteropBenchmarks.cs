@@ -0,0 +1,178 @@
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Text;
+
+namespace UnrealEngine.Tests {
+	public class InteropBenchmarks : ISystem {
+		private const int defaultIterations = 100000;
+		private const int warmupIterations = 1000;
+		private const string eventCommand = "Test.BenchmarkEvent";
+		private const string actorTag = "BenchmarkTag";
+		private static int eventsReceived;
+		private static int overlapsReceived;
+		private readonly List<Result> results = new();
+		private Actor actor;
+		private StaticMeshComponent staticMeshComponent;
+		private Actor overlapActor;
+		private StaticMeshComponent overlapStaticMeshComponent;
+		private PlayerController playerController;
+		private int iterations;
+		private bool completed;
+
+		public void OnBeginPlay() {
+			iterations = ParseIterations(CommandLine.Get());
+
+			actor = new("BenchmarkActor");
+			actor.AddTag(actorTag);
+			staticMeshComponent = new(actor, setAsRoot: true);
+			staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+			staticMeshComponent.SetWorldLocation(new(0.0f, 500.0f, 0.0f));
+			staticMeshComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+
+			overlapActor = new("BenchmarkOverlapActor");
+			overlapStaticMeshComponent = new(overlapActor, setAsRoot: true);
+			overlapStaticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+			overlapStaticMeshComponent.SetWorldLocation(new(0.0f, -500.0f, 0.0f));
+			overlapStaticMeshComponent.SetCollisionResponseToAllChannels(CollisionResponse.Overlap);
+			overlapStaticMeshComponent.SetGenerateOverlapEvents(true);
+			overlapActor.RegisterEvent(ActorEventType.OnActorBeginOverlap);
+
+			World.SetOnActorBeginOverlapCallback(OnBenchmarkOverlap);
+
+			playerController = World.GetFirstPlayerController();
+
+			ConsoleManager.RegisterCommand(eventCommand, "Benchmark event callback", OnBenchmarkEvent);
+
+			Debug.AddOnScreenMessage(-1, 5.0f, Color.MediumTurquoise, "Running interop benchmarks with " + iterations + " iterations per operation...");
+		}
+
+		public void OnTick(float deltaTime) {
+			if (completed)
+				return;
+
+			completed = true;
+
+			RunBenchmarks();
+			WriteResults();
+
+			if (IsHeadless())
+				Application.RequestExit();
+		}
+
+		public void OnEndPlay() {
+			ConsoleManager.UnregisterObject(eventCommand);
+
+			Debug.ClearOnScreenMessages();
+		}
+
+		private void RunBenchmarks() {
+			Vector3 location = new(0.0f, 500.0f, 0.0f);
+			Vector3 traceStart = new(0.0f, 0.0f, 0.0f);
+			Transform transform = default;
+			Hit hit = default;
+			float floatValue = 0.0f;
+
+			Measure("Property.GetFloat", () => actor.GetFloat("CustomTimeDilation", ref floatValue));
+			Measure("Property.SetFloat", () => actor.SetFloat("CustomTimeDilation", 1.0f));
+			Measure("World.GetActor", () => World.GetActor<Actor>("BenchmarkActor"));
+			Measure("World.GetActorByTag", () => World.GetActorByTag<Actor>(actorTag));
+			Measure("World.LineTraceSingleByChannel", () => World.LineTraceSingleByChannel(traceStart, location, CollisionChannel.WorldStatic, ref hit));
+			Measure("SceneComponent.GetLocation", () => staticMeshComponent.GetLocation(ref location));
+			Measure("SceneComponent.SetWorldLocation", () => staticMeshComponent.SetWorldLocation(location));
+			Measure("SceneComponent.GetTransform", () => staticMeshComponent.GetTransform(ref transform));
+			Measure("SceneComponent.SetWorldTransform", () => staticMeshComponent.SetWorldTransform(transform));
+			Measure("Actor.Name", () => _ = actor.Name);
+
+			Vector3 overlapLocation = new(0.0f, -500.0f, 0.0f);
+
+			overlapsReceived = 0;
+
+			staticMeshComponent.SetGenerateOverlapEvents(true);
+
+			// Each operation moves the component into the overlap volume and back, dispatching one begin overlap event through the managed trampoline
+			Measure("Event.ActorBeginOverlap", () => {
+				overlapStaticMeshComponent.SetWorldLocation(location);
+				overlapStaticMeshComponent.SetWorldLocation(overlapLocation);
+			});
+
+			Assert.IsTrue(overlapsReceived == warmupIterations + iterations);
+
+			if (playerController != null) {
+				eventsReceived = 0;
+
+				Measure("ConsoleCommand.RoundTrip", () => playerController.ConsoleCommand(eventCommand + " 1"));
+
+				Assert.IsTrue(eventsReceived == warmupIterations + iterations);
+			}
+		}
+
+		private void Measure(string name, Action operation) {
+			for (int i = 0; i < warmupIterations; i++) {
+				operation();
+			}
+
+			System.Diagnostics.Stopwatch stopwatch = new();
+			long allocatedBytes = GC.GetAllocatedBytesForCurrentThread();
+
+			stopwatch.Start();
+
+			for (int i = 0; i < iterations; i++) {
+				operation();
+			}
+
+			stopwatch.Stop();
+
+			allocatedBytes = GC.GetAllocatedBytesForCurrentThread() - allocatedBytes;
+
+			Result result = new(name, iterations, stopwatch.Elapsed.TotalMilliseconds * 1000000.0 / iterations, (double)allocatedBytes / iterations);
+
+			results.Add(result);
+
+			Debug.Log(LogLevel.Display, string.Format(CultureInfo.InvariantCulture, "{0}: {1:F1} ns/op, {2:F1} bytes/op", result.Name, result.NanosecondsPerOperation, result.BytesPerOperation));
+			Debug.AddOnScreenMessage(-1, 30.0f, Color.LightGreen, string.Format(CultureInfo.InvariantCulture, "{0}: {1:F1} ns/op, {2:F1} B/op", result.Name, result.NanosecondsPerOperation, result.BytesPerOperation));
+		}
+
+		private void WriteResults() {
+			string directory = Application.ProjectDirectory + "Saved/Benchmarks/";
+			string path = directory + "InteropBenchmarks-" + DateTime.Now.ToString("yyyy.MM.dd-HH.mm.ss", CultureInfo.InvariantCulture) + ".csv";
+			StringBuilder builder = new();
+
+			builder.AppendLine("Operation,Iterations,NanosecondsPerOperation,BytesPerOperation");
+
+			foreach (Result result in results) {
+				builder.AppendLine(string.Format(CultureInfo.InvariantCulture, "{0},{1},{2:F3},{3:F3}", result.Name, result.Iterations, result.NanosecondsPerOperation, result.BytesPerOperation));
+			}
+
+			try {
+				Directory.CreateDirectory(directory);
+				File.WriteAllText(path, builder.ToString());
+
+				Debug.Log(LogLevel.Display, "Interop benchmarks results written to " + path);
+			}
+
+			catch (Exception exception) {
+				Debug.Log(LogLevel.Error, "Unable to write interop benchmarks results: " + exception.Message);
+			}
+		}
+
+		private static int ParseIterations(string arguments) {
+			const string parameter = "-BenchmarkIterations=";
+
+			foreach (string argument in arguments.Split(' ', StringSplitOptions.RemoveEmptyEntries)) {
+				if (argument.StartsWith(parameter, StringComparison.OrdinalIgnoreCase) && int.TryParse(argument.AsSpan(parameter.Length), NumberStyles.Integer, CultureInfo.InvariantCulture, out int value) && value > 0)
+					return value;
+			}
+
+			return defaultIterations;
+		}
+
+		private static bool IsHeadless() => !Application.IsCanEverRender || CommandLine.Get().Contains("-nullrhi", StringComparison.OrdinalIgnoreCase);
+
+		private static void OnBenchmarkEvent(float value) => eventsReceived++;
+
+		private static void OnBenchmarkOverlap(ActorReference overlapActor, ActorReference otherActor) => overlapsReceived++;
+
+		private readonly record struct Result(string Name, int Iterations, double NanosecondsPerOperation, double BytesPerOperation);
+	}
+}
\ No newline at end of file
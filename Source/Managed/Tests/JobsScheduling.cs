@@ -0,0 +1,91 @@
+using System.Threading;
+
+namespace UnrealEngine.Tests {
+	public class JobsScheduling : ISystem {
+		private const int elementsCount = 1000;
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			TestDependencies();
+			TestReleasedPrerequisites();
+			TestInvalidPrerequisites();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Jobs scheduling tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private static void TestDependencies() {
+			int[] elements = new int[elementsCount];
+			long sum = 0;
+			int fillJob = Jobs.ScheduleParallel((begin, end) => {
+				for (int i = begin; i < end; i++) {
+					elements[i] = i + 1;
+				}
+			}, elements.Length, 64);
+
+			int sumJob = Jobs.Schedule(() => {
+				for (int i = 0; i < elements.Length; i++) {
+					sum += elements[i];
+				}
+			}, stackalloc int[] { fillJob });
+
+			Assert.IsTrue(fillJob != -1 && sumJob != -1);
+			Assert.IsTrue(fillJob != sumJob);
+
+			Jobs.Wait(sumJob);
+
+			Assert.IsTrue(Jobs.IsCompleted(fillJob));
+			Assert.IsTrue(Jobs.IsCompleted(sumJob));
+			Assert.IsTrue(sum == (long)elementsCount * (elementsCount + 1) / 2);
+
+			Jobs.Release(fillJob);
+			Jobs.Release(sumJob);
+
+			// An empty range completes immediately without executing the job
+			int emptyJob = Jobs.ScheduleParallel((begin, end) => Assert.IsTrue(false), 0, 64);
+
+			Jobs.Wait(emptyJob);
+
+			Assert.IsTrue(Jobs.IsCompleted(emptyJob));
+
+			Jobs.Release(emptyJob);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Parallel jobs filled and summed the elements!");
+		}
+
+		private static void TestReleasedPrerequisites() {
+			using ManualResetEventSlim gate = new(false);
+			int value = 0;
+			int observed = 0;
+			int blockedJob = Jobs.Schedule(() => {
+				gate.Wait();
+				value = 1;
+			});
+
+			// The handle is released while the job is still running, so the dependent job should still wait for it
+			Jobs.Release(blockedJob);
+
+			int dependentJob = Jobs.Schedule(() => observed = value, stackalloc int[] { blockedJob });
+
+			Assert.IsTrue(dependentJob != -1);
+
+			gate.Set();
+			Jobs.Wait(dependentJob);
+
+			Assert.IsTrue(observed == 1);
+
+			Jobs.Release(dependentJob);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Dependent job waited for the released prerequisite!");
+		}
+
+		private static void TestInvalidPrerequisites() {
+			Assert.IsTrue(Jobs.Schedule(() => Assert.IsTrue(false), stackalloc int[] { int.MaxValue }) == -1);
+			Assert.IsTrue(Jobs.ScheduleParallel((begin, end) => Assert.IsTrue(false), elementsCount, 64, stackalloc int[] { -1 }) == -1);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Jobs with unknown prerequisites were rejected!");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+namespace UnrealEngine.Tests {
+	public class MultiHitQueries : ISystem {
+		private Actor overlappingActor;
+		private Actor blockingActor;
+		private StaticMeshComponent overlappingComponent;
+		private StaticMeshComponent blockingComponent;
+		private static readonly Vector3 traceStart = new(0.0f, 0.0f, 0.0f);
+		private static readonly Vector3 traceEnd = new(0.0f, 900.0f, 0.0f);
+		private static readonly Vector3 overlappingLocation = new(0.0f, 300.0f, 0.0f);
+		private static readonly Vector3 blockingLocation = new(0.0f, 600.0f, 0.0f);
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			overlappingActor = new("OverlappingBox");
+			blockingActor = new("BlockingBox");
+
+			overlappingComponent = new(overlappingActor, setAsRoot: true);
+			blockingComponent = new(blockingActor, setAsRoot: true);
+
+			overlappingComponent.SetStaticMesh(StaticMesh.Cube);
+			overlappingComponent.SetWorldLocation(overlappingLocation);
+			overlappingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+			overlappingComponent.SetCollisionResponseToChannel(CollisionChannel.WorldStatic, CollisionResponse.Overlap);
+
+			blockingComponent.SetStaticMesh(StaticMesh.Cube);
+			blockingComponent.SetWorldLocation(blockingLocation);
+			blockingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+
+			TestTraces();
+			TestSweeps();
+			TestOverlaps();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Multi-hit queries tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private void TestTraces() {
+			Span<Hit> hits = new Hit[4];
+			int hitCount = World.LineTraceMultiByChannel(traceStart, traceEnd, CollisionChannel.WorldStatic, hits);
+
+			Assert.IsTrue(hitCount == 2);
+			Assert.IsFalse(hits[0].BlockingHit);
+			Assert.IsTrue(hits[1].BlockingHit);
+			Assert.IsTrue(overlappingActor.Equals(hits[0].GetActor()));
+			Assert.IsTrue(blockingActor.Equals(hits[1].GetActor()));
+
+			// The total number of hits is returned even if the span is too short
+			Assert.IsTrue(World.LineTraceMultiByChannel(traceStart, traceEnd, CollisionChannel.WorldStatic, hits[..1]) == 2);
+			Assert.IsTrue(World.LineTraceMultiByChannel(traceStart, traceEnd, CollisionChannel.WorldStatic, hits, ignoredActor: blockingActor) == 1);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Multi-hit trace found both boxes!");
+		}
+
+		private void TestSweeps() {
+			Span<Hit> hits = new Hit[4];
+			int hitCount = World.SweepMultiByChannel(traceStart, traceEnd, Quaternion.Identity, CollisionChannel.WorldStatic, CollisionShape.CreateSphere(25.0f), hits);
+
+			Assert.IsTrue(hitCount == 2);
+			Assert.IsFalse(hits[0].BlockingHit);
+			Assert.IsTrue(hits[1].BlockingHit);
+			Assert.IsTrue(overlappingActor.Equals(hits[0].GetActor()));
+			Assert.IsTrue(blockingActor.Equals(hits[1].GetActor()));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Multi-hit sweep found both boxes!");
+		}
+
+		private void TestOverlaps() {
+			Span<ComponentReference> components = new ComponentReference[8];
+			int overlapCount = World.OverlapMultiByChannel((overlappingLocation + blockingLocation) * 0.5f, Quaternion.Identity, CollisionChannel.WorldStatic, CollisionShape.CreateBox(new(60.0f, 250.0f, 60.0f)), components);
+			bool overlappingFound = false;
+			bool blockingFound = false;
+
+			Assert.IsTrue(overlapCount >= 2);
+
+			for (int i = 0; i < Math.Min(overlapCount, components.Length); i++) {
+				StaticMeshComponent component = components[i].ToComponent<StaticMeshComponent>();
+
+				overlappingFound |= overlappingComponent.Equals(component);
+				blockingFound |= blockingComponent.Equals(component);
+			}
+
+			Assert.IsTrue(overlappingFound && blockingFound);
+			Assert.IsTrue(World.OverlapMultiByChannel((overlappingLocation + blockingLocation) * 0.5f, Quaternion.Identity, CollisionChannel.WorldStatic, CollisionShape.CreateBox(new(60.0f, 250.0f, 60.0f)), components[..1]) == overlapCount);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Overlap enumeration found both boxes!");
+		}
+	}
+}
\ No newline at end of file
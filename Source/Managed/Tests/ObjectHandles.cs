@@ -0,0 +1,70 @@
+namespace UnrealEngine.Tests {
+	public class ObjectHandles : ISystem {
+		private const int churnedActors = 64;
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			TestDestruction();
+			TestStaleHandles();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Object handles tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private static void TestDestruction() {
+			Actor actor = new("HandledActor");
+			Actor lookedUpActor = World.GetActor<Actor>("HandledActor");
+
+			Assert.IsTrue(actor.IsSpawned);
+			Assert.IsTrue(lookedUpActor.IsSpawned);
+
+			actor.Destroy();
+
+			// Every reference to the destroyed actor observes the destruction through its own handle
+			Assert.IsFalse(actor.IsSpawned);
+			Assert.IsFalse(lookedUpActor.IsSpawned);
+
+			ushort exceptions = 0;
+
+			try {
+				_ = actor.Name;
+			}
+
+			catch (InvalidOperationException) {
+				exceptions++;
+			}
+
+			Assert.IsTrue(exceptions == 1);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Destroyed actor is no longer spawned!");
+		}
+
+		private static void TestStaleHandles() {
+			Actor[] destroyedActors = new Actor[churnedActors];
+
+			for (int i = 0; i < destroyedActors.Length; i++) {
+				destroyedActors[i] = new();
+				destroyedActors[i].Destroy();
+			}
+
+			// Slots and memory of the destroyed actors are reused by the new ones, stale handles must stay invalid
+			Actor[] spawnedActors = new Actor[churnedActors];
+
+			for (int i = 0; i < spawnedActors.Length; i++) {
+				spawnedActors[i] = new();
+			}
+
+			for (int i = 0; i < churnedActors; i++) {
+				Assert.IsFalse(destroyedActors[i].IsSpawned);
+				Assert.IsTrue(spawnedActors[i].IsSpawned);
+				Assert.IsFalse(destroyedActors[i].Equals(spawnedActors[i]));
+
+				spawnedActors[i].Destroy();
+			}
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Stale handles are rejected after reuse!");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+namespace UnrealEngine.Tests {
+	public class QueryDescriptors : ISystem {
+		private Actor overlappingActor;
+		private Actor blockingActor;
+		private StaticMeshComponent blockingComponent;
+		private static readonly Vector3 traceStart = new(0.0f, 0.0f, 0.0f);
+		private static readonly Vector3 traceEnd = new(0.0f, 900.0f, 0.0f);
+		private static readonly Vector3 missOffset = new(1000.0f, 0.0f, 0.0f);
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			overlappingActor = new("OverlappingBox");
+
+			StaticMeshComponent overlappingComponent = new(overlappingActor, setAsRoot: true);
+
+			overlappingComponent.SetStaticMesh(StaticMesh.Cube);
+			overlappingComponent.SetWorldLocation(new(0.0f, 300.0f, 0.0f));
+			overlappingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+			overlappingComponent.SetCollisionResponseToChannel(CollisionChannel.WorldStatic, CollisionResponse.Overlap);
+
+			blockingActor = new("BlockingBox");
+			blockingComponent = new(blockingActor, setAsRoot: true);
+
+			blockingComponent.SetStaticMesh(StaticMesh.Cube);
+			blockingComponent.SetWorldLocation(new(0.0f, 600.0f, 0.0f));
+			blockingComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+
+			TestQueries();
+			TestIgnored();
+			TestStaleHandles();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Query descriptors tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private void TestQueries() {
+			Hit hit = default;
+			Span<Hit> hits = new Hit[4];
+			Span<byte> hitMask = stackalloc byte[1];
+			ReadOnlySpan<Vector3> starts = new Vector3[] { traceStart, traceStart + missOffset };
+			ReadOnlySpan<Vector3> ends = new Vector3[] { traceEnd, traceEnd + missOffset };
+			int query = CollisionQuery.Create(CollisionChannel.WorldStatic);
+
+			Assert.IsTrue(query != -1);
+			Assert.IsTrue(CollisionQuery.LineTraceTest(query, traceStart, traceEnd));
+			Assert.IsTrue(CollisionQuery.LineTraceSingle(query, traceStart, traceEnd, ref hit));
+			Assert.IsTrue(blockingActor.Equals(hit.GetActor()));
+			Assert.IsTrue(CollisionQuery.LineTraceMulti(query, traceStart, traceEnd, hits) == 2);
+			Assert.IsTrue(overlappingActor.Equals(hits[0].GetActor()));
+			Assert.IsTrue(CollisionQuery.LineTraceBatch(query, starts, ends, hits, hitMask) == 1);
+			Assert.IsTrue(hitMask[0] == 0b01);
+			Assert.IsTrue(CollisionQuery.SweepSingle(query, traceStart, traceEnd, Quaternion.Identity, CollisionShape.CreateSphere(25.0f), ref hit));
+			Assert.IsTrue(blockingActor.Equals(hit.GetActor()));
+			Assert.IsTrue(CollisionQuery.SweepMulti(query, traceStart, traceEnd, Quaternion.Identity, CollisionShape.CreateSphere(25.0f), hits) == 2);
+			Assert.IsTrue(CollisionQuery.OverlapAnyTest(query, blockingComponent.GetLocation(), Quaternion.Identity, CollisionShape.CreateSphere(25.0f)));
+			Assert.IsTrue(CollisionQuery.Destroy(query));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Query descriptor traced, swept, and overlapped!");
+		}
+
+		private void TestIgnored() {
+			Span<Hit> hits = new Hit[4];
+			int query = CollisionQuery.Create(CollisionChannel.WorldStatic);
+
+			Assert.IsTrue(CollisionQuery.AddIgnoredActor(query, blockingActor));
+			Assert.IsFalse(CollisionQuery.LineTraceTest(query, traceStart, traceEnd));
+			Assert.IsTrue(CollisionQuery.LineTraceMulti(query, traceStart, traceEnd, hits) == 1);
+			Assert.IsTrue(CollisionQuery.ClearIgnored(query));
+			Assert.IsTrue(CollisionQuery.LineTraceTest(query, traceStart, traceEnd));
+
+			Assert.IsTrue(CollisionQuery.AddIgnoredComponent(query, blockingComponent));
+			Assert.IsFalse(CollisionQuery.SweepTest(query, traceStart, traceEnd, Quaternion.Identity, CollisionShape.CreateSphere(25.0f)));
+			Assert.IsTrue(CollisionQuery.ClearIgnored(query));
+			Assert.IsTrue(CollisionQuery.SweepTest(query, traceStart, traceEnd, Quaternion.Identity, CollisionShape.CreateSphere(25.0f)));
+			Assert.IsTrue(CollisionQuery.Destroy(query));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Query descriptor ignored actors and components!");
+		}
+
+		private void TestStaleHandles() {
+			Hit hit = default;
+			int query = CollisionQuery.Create(CollisionChannel.WorldStatic);
+
+			Assert.IsTrue(CollisionQuery.Destroy(query));
+			Assert.IsFalse(CollisionQuery.Destroy(query));
+			Assert.IsFalse(CollisionQuery.LineTraceSingle(query, traceStart, traceEnd, ref hit));
+
+			// The slot of the destroyed descriptor is reused with a new handle, the stale handle stays rejected
+			int reusedQuery = CollisionQuery.Create(CollisionChannel.WorldStatic);
+
+			Assert.IsTrue(reusedQuery != -1 && reusedQuery != query);
+			Assert.IsFalse(CollisionQuery.LineTraceTest(query, traceStart, traceEnd));
+			Assert.IsFalse(CollisionQuery.AddIgnoredActor(query, blockingActor));
+			Assert.IsTrue(CollisionQuery.LineTraceTest(reusedQuery, traceStart, traceEnd));
+			Assert.IsTrue(CollisionQuery.Destroy(reusedQuery));
+			Assert.IsFalse(CollisionQuery.Destroy(-1));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Stale query descriptor handles rejected!");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+namespace UnrealEngine.Tests {
+	public class SpatialHashing : ISystem {
+		private Actor[] actors;
+		private const int gridSize = 5;
+		private const float spacing = 200.0f;
+		private static readonly Vector3 origin = new(0.0f, -400.0f, 0.0f);
+
+		public SpatialHashing() => actors = new Actor[gridSize * gridSize];
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			SpatialHash.SetCellSize(spacing * 2.0f);
+
+			for (int i = 0; i < actors.Length; i++) {
+				actors[i] = new();
+
+				StaticMeshComponent staticMeshComponent = new(actors[i], setAsRoot: true);
+
+				staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+				staticMeshComponent.SetWorldLocation(GetGridLocation(i % gridSize, i / gridSize));
+
+				Assert.IsTrue(SpatialHash.Add(actors[i]));
+				Assert.IsFalse(SpatialHash.Add(actors[i]));
+			}
+
+			TestQueries();
+			TestRemoval();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Spatial hashing tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private void TestQueries() {
+			Span<ActorReference> results = stackalloc ActorReference[actors.Length];
+			Vector3 center = GetGridLocation(2, 2);
+			Actor centerActor = actors[2 * gridSize + 2];
+
+			Assert.IsTrue(SpatialHash.QueryRadius(center, spacing + 1.0f, results) == 5);
+			Assert.IsTrue(SpatialHash.QueryBox(GetGridLocation(1, 1), GetGridLocation(3, 3), results) == 9);
+			Assert.IsTrue(SpatialHash.QueryBox(GetGridLocation(1, 1), GetGridLocation(3, 3), results[..2]) == 9);
+
+			Assert.IsTrue(SpatialHash.QueryKNearest(center, results[..3]) == 3);
+			Assert.IsTrue(centerActor.Equals(results[0].ToActor<Actor>()));
+			Assert.IsTrue(SpatialHash.QueryKNearest(center, results, spacing * 0.5f) == 1);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Spatial hash queries found the nearby actors!");
+		}
+
+		private void TestRemoval() {
+			Span<ActorReference> results = stackalloc ActorReference[actors.Length];
+			Vector3 center = GetGridLocation(2, 2);
+			Actor centerActor = actors[2 * gridSize + 2];
+
+			Assert.IsTrue(SpatialHash.Remove(actors[2 * gridSize + 1]));
+			Assert.IsFalse(SpatialHash.Remove(actors[2 * gridSize + 1]));
+			Assert.IsTrue(SpatialHash.QueryRadius(center, spacing + 1.0f, results) == 4);
+
+			centerActor.Destroy();
+
+			Assert.IsTrue(SpatialHash.QueryRadius(center, spacing + 1.0f, results) == 3);
+			Assert.IsTrue(SpatialHash.QueryKNearest(center, results, spacing * 0.5f) == 0);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Removed and destroyed actors are not retrieved!");
+		}
+
+		private static Vector3 GetGridLocation(int x, int y) => origin + new Vector3(0.0f, x * spacing, y * spacing);
+	}
+}
\ No newline at end of file
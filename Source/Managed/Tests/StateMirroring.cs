@@ -0,0 +1,82 @@
+namespace UnrealEngine.Tests {
+	public class StateMirroring : ISystem {
+		private Actor[] actors;
+		private SceneComponent[] components;
+		private int mirroredSlot;
+		private int destroyedSlot;
+		private int removedSlot;
+		private int frame;
+		private const int actorsCount = 3;
+		private const float spacing = 200.0f;
+		private static readonly Vector3 movedLocation = new(0.0f, 0.0f, 400.0f);
+
+		public StateMirroring() {
+			actors = new Actor[actorsCount];
+			components = new SceneComponent[actorsCount];
+		}
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			for (int i = 0; i < actors.Length; i++) {
+				actors[i] = new();
+
+				StaticMeshComponent staticMeshComponent = new(actors[i], setAsRoot: true);
+
+				staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+				staticMeshComponent.SetWorldLocation(new(0.0f, (i - 1) * spacing, 0.0f));
+				components[i] = staticMeshComponent;
+			}
+
+			mirroredSlot = Mirror.Add(actors[0]);
+
+			Assert.IsTrue(mirroredSlot >= 0);
+			Assert.IsTrue(Mirror.Add(actors[0]) == mirroredSlot);
+
+			destroyedSlot = Mirror.Add(actors[1]);
+			removedSlot = Mirror.Add(actors[2]);
+
+			Assert.IsTrue(destroyedSlot >= 0 && removedSlot >= 0);
+			Assert.IsTrue(destroyedSlot != mirroredSlot && removedSlot != mirroredSlot);
+
+			// Destroyed actors are unregistered automatically
+			actors[1].Destroy();
+		}
+
+		public void OnTick(float deltaTime) {
+			frame++;
+
+			// States are captured at the end of each frame, so the first complete capture is read in the second frame
+			if (frame == 2) {
+				ReadOnlySpan<ActorState> states = Mirror.States;
+
+				Assert.IsTrue(states.Length > Math.Max(mirroredSlot, removedSlot));
+				Assert.IsTrue(states[mirroredSlot].IsValid);
+				Assert.IsFalse(states[mirroredSlot].IsHidden);
+				Assert.IsTrue(Vector3.Distance(states[mirroredSlot].Location, components[0].GetLocation()) < 1.0f);
+				Assert.IsTrue(states[removedSlot].IsValid);
+				Assert.IsFalse(states[destroyedSlot].IsValid);
+
+				components[0].SetWorldLocation(movedLocation);
+
+				Assert.IsTrue(Mirror.Remove(actors[2]));
+				Assert.IsFalse(Mirror.Remove(actors[2]));
+
+				// States are not updated until the end of the frame
+				Assert.IsTrue(Mirror.States[removedSlot].IsValid);
+
+				Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Actor states captured at the end of the frame!");
+			} else if (frame == 3) {
+				ReadOnlySpan<ActorState> states = Mirror.States;
+
+				Assert.IsTrue(Vector3.Distance(states[mirroredSlot].Location, movedLocation) < 1.0f);
+				Assert.IsFalse(states[removedSlot].IsValid);
+				Assert.IsTrue(Mirror.Remove(actors[0]));
+
+				Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "State mirroring tests completed!");
+			}
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+	}
+}
\ No newline at end of file
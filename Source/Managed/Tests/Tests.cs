@@ -17,6 +17,11 @@ namespace UnrealEngine.Tests {
 				if (World.GetActor<LevelScript>().GetEnum("Test Systems", ref testSystem))
 					Debug.AddOnScreenMessage(-1, 3.0f, Color.LightGreen, testSystem + " system started!");
 
+				foreach (string argument in CommandLine.Get().Split(' ', StringSplitOptions.RemoveEmptyEntries)) {
+					if (argument.StartsWith("-TestSystem=", StringComparison.OrdinalIgnoreCase) && Enum.TryParse(argument["-TestSystem=".Length..], true, out TestSystems commandLineSystem))
+						testSystem = commandLineSystem;
+				}
+
 				runningSystem = testSystem switch {
 					TestSystems.AssertionConsistency => new AssertionConsistency(),
 					TestSystems.AudioPlayback => new AudioPlayback(),
@@ -37,6 +42,24 @@ namespace UnrealEngine.Tests {
 					TestSystems.TextRenderer => new TextRenderer(),
 					TestSystems.TextureAssets => new TextureAssets(),
 					TestSystems.VirtualReality => new VirtualReality(),
+					TestSystems.InteropBenchmarks => new InteropBenchmarks(),
+					TestSystems.JobsScheduling => new JobsScheduling(),
+					TestSystems.WorkerThreadTicks => new WorkerThreadTicks(),
+					TestSystems.TickFunctions => new TickFunctions(),
+					TestSystems.ActorLookup => new ActorLookup(),
+					TestSystems.ActorIteration => new ActorIteration(),
+					TestSystems.SpatialHashing => new SpatialHashing(),
+					TestSystems.TransformReadback => new TransformReadback(),
+					TestSystems.TransformWrites => new TransformWrites(),
+					TestSystems.ObjectHandles => new ObjectHandles(),
+					TestSystems.StateMirroring => new StateMirroring(),
+					TestSystems.ActorPooling => new ActorPooling(),
+					TestSystems.DeferredSpawning => new DeferredSpawning(),
+					TestSystems.BatchedQueries => new BatchedQueries(),
+					TestSystems.AsyncQueries => new AsyncQueries(),
+					TestSystems.MultiHitQueries => new MultiHitQueries(),
+					TestSystems.QueryDescriptors => new QueryDescriptors(),
+					TestSystems.CompactHitResults => new CompactHitResults(),
 					_ => throw new Exception("Unknown system")
 				};
 			}
@@ -71,7 +94,25 @@ namespace UnrealEngine.Tests {
 			StaticMeshes,
 			TextRenderer,
 			TextureAssets,
-			VirtualReality
+			VirtualReality,
+			InteropBenchmarks,
+			JobsScheduling,
+			WorkerThreadTicks,
+			TickFunctions,
+			ActorLookup,
+			ActorIteration,
+			SpatialHashing,
+			TransformReadback,
+			TransformWrites,
+			ObjectHandles,
+			StateMirroring,
+			ActorPooling,
+			DeferredSpawning,
+			BatchedQueries,
+			AsyncQueries,
+			MultiHitQueries,
+			QueryDescriptors,
+			CompactHitResults
 		}
 	}
 
@@ -0,0 +1,63 @@
+namespace UnrealEngine.Tests {
+	public class TickFunctions : ISystem {
+		private Actor actor;
+		private int tickHandle;
+		private int disabledHandle;
+		private int replacementHandle;
+		private int tickCalls;
+		private int disabledCalls;
+		private int replacementCalls;
+		private int frame;
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			actor = new("TickPrerequisite");
+			tickHandle = World.RegisterTickFunction(deltaTime => tickCalls++, TickGroup.PostPhysics);
+			disabledHandle = World.RegisterTickFunction(deltaTime => disabledCalls++, TickGroup.PostPhysics);
+
+			Assert.IsTrue(tickHandle != -1 && disabledHandle != -1);
+			Assert.IsTrue(tickHandle != disabledHandle);
+			Assert.IsTrue(World.SetTickFunctionEnabled(disabledHandle, false));
+			Assert.IsTrue(World.AddTickPrerequisite(tickHandle, actor));
+		}
+
+		public void OnTick(float deltaTime) {
+			frame++;
+
+			if (frame == 5) {
+				Assert.IsTrue(tickCalls > 0);
+				Assert.IsTrue(disabledCalls == 0);
+
+				Assert.IsTrue(World.UnregisterTickFunction(tickHandle));
+				Assert.IsFalse(World.UnregisterTickFunction(tickHandle));
+				Assert.IsFalse(World.SetTickFunctionEnabled(tickHandle, true));
+
+				// The slot of the unregistered function is reused with a new handle, the stale handle stays rejected
+				replacementHandle = World.RegisterTickFunction(deltaTime => replacementCalls++, TickGroup.PostPhysics);
+
+				Assert.IsTrue(replacementHandle != -1 && replacementHandle != tickHandle);
+				Assert.IsFalse(World.SetTickFunctionEnabled(tickHandle, false));
+
+				tickCalls = 0;
+
+				// Registered callbacks are kept alive by the framework
+				GC.Collect();
+				GC.WaitForPendingFinalizers();
+
+				Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Unregistered tick function rejected by its handle!");
+			} else if (frame == 10) {
+				Assert.IsTrue(tickCalls == 0);
+				Assert.IsTrue(disabledCalls == 0);
+				Assert.IsTrue(replacementCalls >= 2);
+
+				Assert.IsTrue(World.UnregisterTickFunction(disabledHandle));
+				Assert.IsTrue(World.UnregisterTickFunction(replacementHandle));
+
+				Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Tick functions tests completed!");
+			}
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+namespace UnrealEngine.Tests {
+	public class TransformReadback : ISystem {
+		private SceneComponent[] components;
+		private const int componentsCount = 4;
+		private const float spacing = 200.0f;
+
+		public TransformReadback() => components = new SceneComponent[componentsCount];
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			for (int i = 0; i < components.Length; i++) {
+				Actor actor = new();
+				StaticMeshComponent staticMeshComponent = new(actor, setAsRoot: true);
+
+				staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+				staticMeshComponent.SetWorldLocation(GetLocation(i));
+				components[i] = staticMeshComponent;
+			}
+
+			TestTransforms();
+			TestLocations();
+			TestInvalidComponents();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Transform readback tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private void TestTransforms() {
+			Span<Transform> transforms = stackalloc Transform[componentsCount];
+
+			SceneComponent.GetTransforms(components, transforms);
+
+			for (int i = 0; i < componentsCount; i++) {
+				Transform transform = components[i].GetTransform();
+
+				Assert.IsTrue(Vector3.Distance(transforms[i].Location, transform.Location) < 1.0f);
+				Assert.IsTrue(Vector3.Distance(transforms[i].Scale, transform.Scale) < 0.01f);
+				Assert.IsTrue(Vector3.Distance(transforms[i].Location, GetLocation(i)) < 1.0f);
+			}
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Transforms retrieved in a single call!");
+		}
+
+		private void TestLocations() {
+			Span<Vector3> locations = stackalloc Vector3[componentsCount];
+			Span<float> x = stackalloc float[componentsCount];
+			Span<float> y = stackalloc float[componentsCount];
+			Span<float> z = stackalloc float[componentsCount];
+
+			SceneComponent.GetLocations(components, locations);
+			SceneComponent.GetLocations(components, x, y, z);
+
+			for (int i = 0; i < componentsCount; i++) {
+				Assert.IsTrue(Vector3.Distance(locations[i], components[i].GetLocation()) < 1.0f);
+				Assert.IsTrue(Vector3.Distance(new(x[i], y[i], z[i]), locations[i]) < 1.0f);
+			}
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Locations retrieved in a single call!");
+		}
+
+		private void TestInvalidComponents() {
+			SceneComponent[] mixedComponents = { components[0], null, components[1] };
+			Span<Transform> transforms = stackalloc Transform[mixedComponents.Length];
+			Span<Vector3> locations = stackalloc Vector3[mixedComponents.Length];
+
+			// Spans are prefilled to ensure that values of invalid components are written
+			transforms.Fill(new(Vector3.One, Quaternion.Identity, new(2.0f)));
+			locations.Fill(Vector3.One);
+
+			SceneComponent.GetTransforms(mixedComponents, transforms);
+			SceneComponent.GetLocations(mixedComponents, locations);
+
+			Assert.IsTrue(transforms[1].Location == Vector3.Zero);
+			Assert.IsTrue(transforms[1].Rotation == Quaternion.Identity);
+			Assert.IsTrue(transforms[1].Scale == Vector3.One);
+			Assert.IsTrue(locations[1] == Vector3.Zero);
+			Assert.IsTrue(Vector3.Distance(locations[2], GetLocation(1)) < 1.0f);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Invalid components yield the identity transform and zero location!");
+		}
+
+		private static Vector3 GetLocation(int index) => new(0.0f, (index - componentsCount / 2) * spacing, 0.0f);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+namespace UnrealEngine.Tests {
+	public class TransformWrites : ISystem {
+		private Actor[] actors;
+		private SceneComponent[] components;
+		private SceneComponent childComponent;
+		private const int componentsCount = 4;
+		private const float spacing = 200.0f;
+
+		public TransformWrites() {
+			actors = new Actor[componentsCount];
+			components = new SceneComponent[componentsCount];
+		}
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			for (int i = 0; i < components.Length; i++) {
+				actors[i] = new();
+
+				StaticMeshComponent staticMeshComponent = new(actors[i], setAsRoot: true);
+
+				staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+				staticMeshComponent.SetWorldLocation(GetLocation(i, 0.0f));
+				components[i] = staticMeshComponent;
+			}
+
+			StaticMeshComponent childStaticMeshComponent = new(actors[0]);
+
+			childStaticMeshComponent.SetStaticMesh(StaticMesh.Sphere);
+			childStaticMeshComponent.AttachToComponent(components[0], AttachmentTransformRule.KeepRelativeTransform);
+			childComponent = childStaticMeshComponent;
+
+			TestWorldLocations();
+			TestWorldTransforms();
+			TestRelativeTransforms();
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Transform writes tests completed!");
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		private void TestWorldLocations() {
+			Span<Vector3> locations = stackalloc Vector3[componentsCount];
+
+			for (int i = 0; i < componentsCount; i++) {
+				locations[i] = GetLocation(i, spacing);
+			}
+
+			SceneComponent.SetWorldLocations(components, locations, teleport: true);
+
+			for (int i = 0; i < componentsCount; i++) {
+				Assert.IsTrue(Vector3.Distance(components[i].GetLocation(), locations[i]) < 1.0f);
+			}
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Locations set in a single call!");
+		}
+
+		private void TestWorldTransforms() {
+			Span<Transform> transforms = stackalloc Transform[componentsCount];
+
+			for (int i = 0; i < componentsCount; i++) {
+				transforms[i] = new(GetLocation(i, spacing * 2.0f), Quaternion.Identity, Vector3.One);
+			}
+
+			SceneComponent.SetWorldTransforms(components, transforms, teleport: true);
+
+			for (int i = 0; i < componentsCount; i++) {
+				Assert.IsTrue(Vector3.Distance(components[i].GetLocation(), transforms[i].Location) < 1.0f);
+			}
+
+			// Attached components follow their parents moved in a batch
+			Assert.IsTrue(Vector3.Distance(childComponent.GetLocation(), transforms[0].Location) < 1.0f);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Transforms set in a single call!");
+		}
+
+		private void TestRelativeTransforms() {
+			Vector3 offset = new(0.0f, 0.0f, spacing);
+			SceneComponent[] mixedComponents = { childComponent, null };
+			Span<Transform> transforms = stackalloc Transform[mixedComponents.Length];
+
+			transforms.Fill(new(offset, Quaternion.Identity, Vector3.One));
+
+			// Invalid components are skipped
+			SceneComponent.SetRelativeTransforms(mixedComponents, transforms, teleport: true);
+
+			Assert.IsTrue(Vector3.Distance(childComponent.GetLocation(), components[0].GetLocation() + offset) < 1.0f);
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Relative transforms set in a single call!");
+		}
+
+		private static Vector3 GetLocation(int index, float height) => new(0.0f, (index - componentsCount / 2) * spacing, height);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+namespace UnrealEngine.Tests {
+	public class WorkerThreadTicks : ISystem {
+		private int frame;
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			// The pre-physics group runs this system and physics simulation is started by the engine, so both stay on the game thread
+			Assert.IsFalse(World.SetRunOnAnyThread(TickGroup.PrePhysics, true));
+			Assert.IsFalse(World.SetRunOnAnyThread(TickGroup.StartPhysics, true));
+
+			Assert.IsTrue(World.SetRunOnAnyThread(TickGroup.DuringPhysics, true));
+			Assert.IsTrue(World.SetRunOnAnyThread(TickGroup.PostPhysics, true));
+			Assert.IsTrue(World.SetRunOnAnyThread(TickGroup.PostUpdateWork, true));
+
+			Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Tick groups moved to worker threads!");
+		}
+
+		public void OnTick(float deltaTime) {
+			frame++;
+
+			if (frame == 3) {
+				Assert.IsTrue(World.SetRunOnAnyThread(TickGroup.DuringPhysics, false));
+				Assert.IsTrue(World.SetRunOnAnyThread(TickGroup.PostPhysics, false));
+				Assert.IsTrue(World.SetRunOnAnyThread(TickGroup.PostUpdateWork, false));
+
+				Debug.AddOnScreenMessage(-1, 15.0f, Color.LightGreen, "Worker thread ticks tests completed!");
+			}
+		}
+
+		public void OnEndPlay() => Debug.ClearOnScreenMessages();
+	}
+}
\ No newline at end of file
@@ -156,7 +156,7 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::AssertFunctions;
 
-				Shared::AssertFunctions[head++] = (void*)&UnrealCLRFramework::Assert::OutputMessage;
+				Shared::AssertFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Assert::OutputMessage);
 
 				checksum += head;
 			}
@@ -165,9 +165,9 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::CommandLineFunctions;
 
-				Shared::CommandLineFunctions[head++] = (void*)&UnrealCLRFramework::CommandLine::Get;
-				Shared::CommandLineFunctions[head++] = (void*)&UnrealCLRFramework::CommandLine::Set;
-				Shared::CommandLineFunctions[head++] = (void*)&UnrealCLRFramework::CommandLine::Append;
+				Shared::CommandLineFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::CommandLine::Get);
+				Shared::CommandLineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CommandLine::Set);
+				Shared::CommandLineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CommandLine::Append);
 
 				checksum += head;
 			}
@@ -176,18 +176,18 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::DebugFunctions;
 
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::Log;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::Exception;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::AddOnScreenMessage;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::ClearOnScreenMessages;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::DrawBox;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::DrawCapsule;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::DrawCone;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::DrawCylinder;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::DrawSphere;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::DrawLine;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::DrawPoint;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::FlushPersistentLines;
+				Shared::DebugFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Debug::Log);
+				Shared::DebugFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Debug::Exception);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::AddOnScreenMessage);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::ClearOnScreenMessages);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::DrawBox);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::DrawCapsule);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::DrawCone);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::DrawCylinder);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::DrawSphere);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::DrawLine);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::DrawPoint);
+				Shared::DebugFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Debug::FlushPersistentLines);
 
 				checksum += head;
 			}
@@ -196,41 +196,41 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ObjectFunctions;
 
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::IsPendingKill;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::IsValid;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::Load;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::Rename;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::Invoke;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::ToActor;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::ToComponent;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetID;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetName;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetBool;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetByte;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetShort;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetInt;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetLong;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetUShort;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetUInt;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetULong;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetFloat;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetDouble;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetEnum;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetString;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::GetText;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetBool;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetByte;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetShort;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetInt;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetLong;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetUShort;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetUInt;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetULong;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetFloat;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetDouble;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetEnum;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetString;
-				Shared::ObjectFunctions[head++] = (void*)&UnrealCLRFramework::Object::SetText;
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::IsPendingKill);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::IsValid);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::Load);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::Rename);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::Invoke);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::ToActor);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::ToComponent);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetID);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetName);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetBool);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetByte);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetShort);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetInt);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetLong);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetUShort);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetUInt);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetULong);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetFloat);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetDouble);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetEnum);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetString);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::GetText);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetBool);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetByte);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetShort);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetInt);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetLong);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetUShort);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetUInt);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetULong);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetFloat);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetDouble);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetEnum);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetString);
+				Shared::ObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Object::SetText);
 
 				checksum += head;
 			}
@@ -239,16 +239,16 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ApplicationFunctions;
 
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::IsCanEverRender;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::IsPackagedForDistribution;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::IsPackagedForShipping;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::GetProjectDirectory;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::GetDefaultLanguage;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::GetProjectName;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::GetVolumeMultiplier;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::SetProjectName;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::SetVolumeMultiplier;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::RequestExit;
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::IsCanEverRender);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::IsPackagedForDistribution);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::IsPackagedForShipping);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::GetProjectDirectory);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::GetDefaultLanguage);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::GetProjectName);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::GetVolumeMultiplier);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::SetProjectName);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::SetVolumeMultiplier);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Application::RequestExit);
 
 				checksum += head;
 			}
@@ -257,14 +257,14 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ConsoleManagerFunctions;
 
-				Shared::ConsoleManagerFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleManager::IsRegisteredVariable;
-				Shared::ConsoleManagerFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleManager::FindVariable;
-				Shared::ConsoleManagerFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleManager::RegisterVariableBool;
-				Shared::ConsoleManagerFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleManager::RegisterVariableInt;
-				Shared::ConsoleManagerFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleManager::RegisterVariableFloat;
-				Shared::ConsoleManagerFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleManager::RegisterVariableString;
-				Shared::ConsoleManagerFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleManager::RegisterCommand;
-				Shared::ConsoleManagerFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleManager::UnregisterObject;
+				Shared::ConsoleManagerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleManager::IsRegisteredVariable);
+				Shared::ConsoleManagerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleManager::FindVariable);
+				Shared::ConsoleManagerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleManager::RegisterVariableBool);
+				Shared::ConsoleManagerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleManager::RegisterVariableInt);
+				Shared::ConsoleManagerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleManager::RegisterVariableFloat);
+				Shared::ConsoleManagerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleManager::RegisterVariableString);
+				Shared::ConsoleManagerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleManager::RegisterCommand);
+				Shared::ConsoleManagerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleManager::UnregisterObject);
 
 				checksum += head;
 			}
@@ -273,23 +273,23 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::EngineFunctions;
 
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::IsSplitScreen;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::IsEditor;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::IsForegroundWindow;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::IsExitRequested;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::GetNetMode;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::GetFrameNumber;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::GetViewportSize;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::GetScreenResolution;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::GetWindowMode;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::GetVersion;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::GetMaxFPS;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::SetMaxFPS;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::SetTitle;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::AddActionMapping;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::AddAxisMapping;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::ForceGarbageCollection;
-				Shared::EngineFunctions[head++] = (void*)&UnrealCLRFramework::Engine::DelayGarbageCollection;
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::IsSplitScreen);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::IsEditor);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::IsForegroundWindow);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::IsExitRequested);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::GetNetMode);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::GetFrameNumber);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::GetViewportSize);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::GetScreenResolution);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::GetWindowMode);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::GetVersion);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::GetMaxFPS);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::SetMaxFPS);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::SetTitle);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::AddActionMapping);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::AddAxisMapping);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::ForceGarbageCollection);
+				Shared::EngineFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Engine::DelayGarbageCollection);
 
 				checksum += head;
 			}
@@ -298,12 +298,12 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::HeadMountedDisplayFunctions;
 
-				Shared::HeadMountedDisplayFunctions[head++] = (void*)&UnrealCLRFramework::HeadMountedDisplay::IsConnected;
-				Shared::HeadMountedDisplayFunctions[head++] = (void*)&UnrealCLRFramework::HeadMountedDisplay::GetEnabled;
-				Shared::HeadMountedDisplayFunctions[head++] = (void*)&UnrealCLRFramework::HeadMountedDisplay::GetLowPersistenceMode;
-				Shared::HeadMountedDisplayFunctions[head++] = (void*)&UnrealCLRFramework::HeadMountedDisplay::GetDeviceName;
-				Shared::HeadMountedDisplayFunctions[head++] = (void*)&UnrealCLRFramework::HeadMountedDisplay::SetEnable;
-				Shared::HeadMountedDisplayFunctions[head++] = (void*)&UnrealCLRFramework::HeadMountedDisplay::SetLowPersistenceMode;
+				Shared::HeadMountedDisplayFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::HeadMountedDisplay::IsConnected);
+				Shared::HeadMountedDisplayFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::HeadMountedDisplay::GetEnabled);
+				Shared::HeadMountedDisplayFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::HeadMountedDisplay::GetLowPersistenceMode);
+				Shared::HeadMountedDisplayFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::HeadMountedDisplay::GetDeviceName);
+				Shared::HeadMountedDisplayFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::HeadMountedDisplay::SetEnable);
+				Shared::HeadMountedDisplayFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::HeadMountedDisplay::SetLowPersistenceMode);
 
 				checksum += head;
 			}
@@ -312,49 +312,158 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::WorldFunctions;
 
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::ForEachActor;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetActorCount;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetDeltaSeconds;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetRealTimeSeconds;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetTimeSeconds;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetCurrentLevelName;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetSimulatePhysics;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetWorldOrigin;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetActor;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetActorByTag;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetActorByID;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetFirstPlayerController;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::GetGameMode;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnActorBeginOverlapCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnActorBeginCursorOverCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnActorEndCursorOverCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnActorClickedCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnActorReleasedCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnActorEndOverlapCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnActorHitCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnComponentBeginOverlapCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnComponentEndOverlapCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnComponentHitCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnComponentBeginCursorOverCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnComponentEndCursorOverCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnComponentClickedCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetOnComponentReleasedCallback;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetSimulatePhysics;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetGravity;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SetWorldOrigin;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::OpenLevel;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::LineTraceTestByChannel;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::LineTraceTestByProfile;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::LineTraceSingleByChannel;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::LineTraceSingleByProfile;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SweepTestByChannel;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SweepTestByProfile;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SweepSingleByChannel;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::SweepSingleByProfile;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::OverlapAnyTestByChannel;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::OverlapAnyTestByProfile;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::OverlapBlockingTestByChannel;
-				Shared::WorldFunctions[head++] = (void*)&UnrealCLRFramework::World::OverlapBlockingTestByProfile;
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetActors);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetActorCount);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetDeltaSeconds);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetRealTimeSeconds);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetTimeSeconds);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetCurrentLevelName);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetSimulatePhysics);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetWorldOrigin);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetActor);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetActorByTag);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetActorsByTag);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetActorByID);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetFirstPlayerController);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::GetGameMode);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnActorBeginOverlapCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnActorBeginCursorOverCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnActorEndCursorOverCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnActorClickedCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnActorReleasedCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnActorEndOverlapCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnActorHitCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnComponentBeginOverlapCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnComponentEndOverlapCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnComponentHitCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnComponentBeginCursorOverCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnComponentEndCursorOverCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnComponentClickedCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnComponentReleasedCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetEventsBatching);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetRunOnAnyThread);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::RegisterTickFunction);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::UnregisterTickFunction);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetTickFunctionEnabled);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::AddTickPrerequisiteActor);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::AddTickPrerequisiteComponent);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetFixedTick);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetSimulatePhysics);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetGravity);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetWorldOrigin);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::OpenLevel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::LineTraceTestByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::LineTraceTestByProfile);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::LineTraceSingleByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::LineTraceSingleByProfile);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SweepTestByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SweepTestByProfile);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SweepSingleByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SweepSingleByProfile);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::OverlapAnyTestByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::OverlapAnyTestByProfile);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::OverlapBlockingTestByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::OverlapBlockingTestByProfile);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::LineTraceBatchByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SweepBatchByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SetOnAsyncQueriesCallback);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::AsyncLineTraceByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::AsyncSweepByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::AsyncOverlapByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::LineTraceMultiByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::LineTraceMultiByProfile);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SweepMultiByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::SweepMultiByProfile);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::OverlapMultiByChannel);
+				Shared::WorldFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::World::OverlapMultiByProfile);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::JobsFunctions;
+
+				Shared::JobsFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Jobs::Schedule);
+				Shared::JobsFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Jobs::ScheduleParallel);
+				Shared::JobsFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Jobs::IsCompleted);
+				Shared::JobsFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Jobs::Wait);
+				Shared::JobsFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Jobs::Release);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::SpatialHashFunctions;
+
+				Shared::SpatialHashFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpatialHash::SetCellSize);
+				Shared::SpatialHashFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpatialHash::Add);
+				Shared::SpatialHashFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpatialHash::Remove);
+				Shared::SpatialHashFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpatialHash::QueryRadius);
+				Shared::SpatialHashFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpatialHash::QueryBox);
+				Shared::SpatialHashFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpatialHash::QueryKNearest);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::HandlesFunctions;
+
+				Shared::HandlesFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Handles::GetTable);
+				Shared::HandlesFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Handles::Acquire);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::MirrorFunctions;
+
+				Shared::MirrorFunctions[head++] = UNREALCLR_THREADSAFE_FUNCTION(UnrealCLRFramework::Mirror::GetTable);
+				Shared::MirrorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Mirror::Add);
+				Shared::MirrorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Mirror::Remove);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::ActorPoolFunctions;
+
+				Shared::ActorPoolFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorPool::Acquire);
+				Shared::ActorPoolFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorPool::Release);
+				Shared::ActorPoolFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorPool::Prewarm);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::CollisionQueryFunctions;
+
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::Create);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::Destroy);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::AddIgnoredActor);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::AddIgnoredComponent);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::ClearIgnored);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::AddObjectType);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::SetMobility);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::SetTraceComplex);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::LineTraceTest);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::LineTraceSingle);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::LineTraceMulti);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::LineTraceBatch);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::SweepTest);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::SweepSingle);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::SweepMulti);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::OverlapAnyTest);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::OverlapMulti);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::LineTraceMultiCompact);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::LineTraceBatchCompact);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::SweepMultiCompact);
+				Shared::CollisionQueryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CollisionQuery::SweepBatchCompact);
 
 				checksum += head;
 			}
@@ -363,9 +472,9 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::AssetFunctions;
 
-				Shared::AssetFunctions[head++] = (void*)&UnrealCLRFramework::Asset::IsValid;
-				Shared::AssetFunctions[head++] = (void*)&UnrealCLRFramework::Asset::GetName;
-				Shared::AssetFunctions[head++] = (void*)&UnrealCLRFramework::Asset::GetPath;
+				Shared::AssetFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Asset::IsValid);
+				Shared::AssetFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Asset::GetName);
+				Shared::AssetFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Asset::GetPath);
 
 				checksum += head;
 			}
@@ -374,9 +483,9 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::AssetRegistryFunctions;
 
-				Shared::AssetRegistryFunctions[head++] = (void*)&UnrealCLRFramework::AssetRegistry::Get;
-				Shared::AssetRegistryFunctions[head++] = (void*)&UnrealCLRFramework::AssetRegistry::HasAssets;
-				Shared::AssetRegistryFunctions[head++] = (void*)&UnrealCLRFramework::AssetRegistry::ForEachAsset;
+				Shared::AssetRegistryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AssetRegistry::Get);
+				Shared::AssetRegistryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AssetRegistry::HasAssets);
+				Shared::AssetRegistryFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AssetRegistry::ForEachAsset);
 
 				checksum += head;
 			}
@@ -385,8 +494,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::BlueprintFunctions;
 
-				Shared::BlueprintFunctions[head++] = (void*)&UnrealCLRFramework::Blueprint::IsValidActorClass;
-				Shared::BlueprintFunctions[head++] = (void*)&UnrealCLRFramework::Blueprint::IsValidComponentClass;
+				Shared::BlueprintFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Blueprint::IsValidActorClass);
+				Shared::BlueprintFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Blueprint::IsValidComponentClass);
 
 				checksum += head;
 			}
@@ -395,10 +504,10 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ConsoleObjectFunctions;
 
-				Shared::ConsoleObjectFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleObject::IsBool;
-				Shared::ConsoleObjectFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleObject::IsInt;
-				Shared::ConsoleObjectFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleObject::IsFloat;
-				Shared::ConsoleObjectFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleObject::IsString;
+				Shared::ConsoleObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleObject::IsBool);
+				Shared::ConsoleObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleObject::IsInt);
+				Shared::ConsoleObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleObject::IsFloat);
+				Shared::ConsoleObjectFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleObject::IsString);
 
 				checksum += head;
 			}
@@ -407,16 +516,16 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ConsoleVariableFunctions;
 
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::GetBool;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::GetInt;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::GetFloat;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::GetString;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::SetBool;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::SetInt;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::SetFloat;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::SetString;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::SetOnChangedCallback;
-				Shared::ConsoleVariableFunctions[head++] = (void*)&UnrealCLRFramework::ConsoleVariable::ClearOnChangedCallback;
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::GetBool);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::GetInt);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::GetFloat);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::GetString);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::SetBool);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::SetInt);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::SetFloat);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::SetString);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::SetOnChangedCallback);
+				Shared::ConsoleVariableFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ConsoleVariable::ClearOnChangedCallback);
 
 				checksum += head;
 			}
@@ -425,40 +534,44 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ActorFunctions;
 
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::IsPendingKill;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::IsRootComponentMovable;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::IsOverlappingActor;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::ForEachComponent;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::ForEachAttachedActor;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::ForEachChildActor;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::ForEachOverlappingActor;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::Spawn;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::Destroy;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::Rename;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::Hide;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::TeleportTo;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetComponent;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetComponentByTag;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetComponentByID;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetRootComponent;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetInputComponent;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetCreationTime;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetBlockInput;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetDistanceTo;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetHorizontalDistanceTo;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetBounds;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::GetEyesViewPoint;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::SetRootComponent;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::SetInputComponent;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::SetBlockInput;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::SetLifeSpan;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::SetEnableInput;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::SetEnableCollision;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::AddTag;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::RemoveTag;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::HasTag;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::RegisterEvent;
-				Shared::ActorFunctions[head++] = (void*)&UnrealCLRFramework::Actor::UnregisterEvent;
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::IsPendingKill);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::IsRootComponentMovable);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::IsOverlappingActor);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::ForEachComponent);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::ForEachAttachedActor);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::ForEachChildActor);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::ForEachOverlappingActor);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::Spawn);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::Destroy);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::Rename);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::Hide);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::TeleportTo);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetComponent);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetComponentByTag);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetComponentByID);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetRootComponent);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetInputComponent);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetCreationTime);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetBlockInput);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetDistanceTo);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetHorizontalDistanceTo);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetBounds);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::GetEyesViewPoint);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::SetRootComponent);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::SetInputComponent);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::SetBlockInput);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::SetLifeSpan);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::SetEnableInput);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::SetEnableCollision);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::AddTag);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::RemoveTag);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::HasTag);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::RegisterEvent);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::UnregisterEvent);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::SpawnDeferred);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::FinishSpawning);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::SpawnBatch);
+				Shared::ActorFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Actor::FinishSpawningBatch);
 
 				checksum += head;
 			}
@@ -467,9 +580,9 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::GameModeBaseFunctions;
 
-				Shared::GameModeBaseFunctions[head++] = (void*)&UnrealCLRFramework::GameModeBase::GetUseSeamlessTravel;
-				Shared::GameModeBaseFunctions[head++] = (void*)&UnrealCLRFramework::GameModeBase::SetUseSeamlessTravel;
-				Shared::GameModeBaseFunctions[head++] = (void*)&UnrealCLRFramework::GameModeBase::SwapPlayerControllers;
+				Shared::GameModeBaseFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::GameModeBase::GetUseSeamlessTravel);
+				Shared::GameModeBaseFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::GameModeBase::SetUseSeamlessTravel);
+				Shared::GameModeBaseFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::GameModeBase::SwapPlayerControllers);
 
 				checksum += head;
 			}
@@ -478,25 +591,25 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::PawnFunctions;
 
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::IsControlled;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::IsPlayerControlled;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::GetAutoPossessAI;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::GetAutoPossessPlayer;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::GetUseControllerRotationYaw;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::GetUseControllerRotationPitch;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::GetUseControllerRotationRoll;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::GetGravityDirection;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::GetAIController;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::GetPlayerController;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::SetAutoPossessAI;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::SetAutoPossessPlayer;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::SetUseControllerRotationYaw;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::SetUseControllerRotationPitch;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::SetUseControllerRotationRoll;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::AddControllerYawInput;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::AddControllerPitchInput;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::AddControllerRollInput;
-				Shared::PawnFunctions[head++] = (void*)&UnrealCLRFramework::Pawn::AddMovementInput;
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::IsControlled);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::IsPlayerControlled);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::GetAutoPossessAI);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::GetAutoPossessPlayer);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::GetUseControllerRotationYaw);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::GetUseControllerRotationPitch);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::GetUseControllerRotationRoll);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::GetGravityDirection);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::GetAIController);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::GetPlayerController);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::SetAutoPossessAI);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::SetAutoPossessPlayer);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::SetUseControllerRotationYaw);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::SetUseControllerRotationPitch);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::SetUseControllerRotationRoll);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::AddControllerYawInput);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::AddControllerPitchInput);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::AddControllerRollInput);
+				Shared::PawnFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Pawn::AddMovementInput);
 
 				checksum += head;
 			}
@@ -505,17 +618,17 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::CharacterFunctions;
 
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::IsCrouched;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::CanCrouch;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::CanJump;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::CheckJumpInput;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::ClearJumpInput;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::Launch;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::Crouch;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::StopCrouching;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::Jump;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::StopJumping;
-				Shared::CharacterFunctions[head++] = (void*)&UnrealCLRFramework::Character::SetOnLandedCallback;
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::IsCrouched);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::CanCrouch);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::CanJump);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::CheckJumpInput);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::ClearJumpInput);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::Launch);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::Crouch);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::StopCrouching);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::Jump);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::StopJumping);
+				Shared::CharacterFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Character::SetOnLandedCallback);
 
 				checksum += head;
 			}
@@ -524,23 +637,23 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ControllerFunctions;
 
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::IsLookInputIgnored;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::IsMoveInputIgnored;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::IsPlayerController;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::GetPawn;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::GetCharacter;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::GetViewTarget;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::GetControlRotation;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::GetDesiredRotation;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::LineOfSightTo;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::SetControlRotation;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::SetInitialLocationAndRotation;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::SetIgnoreLookInput;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::SetIgnoreMoveInput;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::ResetIgnoreLookInput;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::ResetIgnoreMoveInput;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::Possess;
-				Shared::ControllerFunctions[head++] = (void*)&UnrealCLRFramework::Controller::Unpossess;
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::IsLookInputIgnored);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::IsMoveInputIgnored);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::IsPlayerController);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::GetPawn);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::GetCharacter);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::GetViewTarget);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::GetControlRotation);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::GetDesiredRotation);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::LineOfSightTo);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::SetControlRotation);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::SetInitialLocationAndRotation);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::SetIgnoreLookInput);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::SetIgnoreMoveInput);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::ResetIgnoreLookInput);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::ResetIgnoreMoveInput);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::Possess);
+				Shared::ControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Controller::Unpossess);
 
 				checksum += head;
 			}
@@ -549,13 +662,13 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::AIControllerFunctions;
 
-				Shared::AIControllerFunctions[head++] = (void*)&UnrealCLRFramework::AIController::ClearFocus;
-				Shared::AIControllerFunctions[head++] = (void*)&UnrealCLRFramework::AIController::GetFocalPoint;
-				Shared::AIControllerFunctions[head++] = (void*)&UnrealCLRFramework::AIController::SetFocalPoint;
-				Shared::AIControllerFunctions[head++] = (void*)&UnrealCLRFramework::AIController::GetFocusActor;
-				Shared::AIControllerFunctions[head++] = (void*)&UnrealCLRFramework::AIController::GetAllowStrafe;
-				Shared::AIControllerFunctions[head++] = (void*)&UnrealCLRFramework::AIController::SetAllowStrafe;
-				Shared::AIControllerFunctions[head++] = (void*)&UnrealCLRFramework::AIController::SetFocus;
+				Shared::AIControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AIController::ClearFocus);
+				Shared::AIControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AIController::GetFocalPoint);
+				Shared::AIControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AIController::SetFocalPoint);
+				Shared::AIControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AIController::GetFocusActor);
+				Shared::AIControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AIController::GetAllowStrafe);
+				Shared::AIControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AIController::SetAllowStrafe);
+				Shared::AIControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AIController::SetFocus);
 
 				checksum += head;
 			}
@@ -564,26 +677,26 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::PlayerControllerFunctions;
 
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::IsPaused;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::GetShowMouseCursor;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::GetEnableClickEvents;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::GetEnableMouseOverEvents;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::GetMousePosition;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::GetPlayer;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::GetPlayerInput;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::GetHitResultAtScreenPosition;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::GetHitResultUnderCursor;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::SetShowMouseCursor;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::SetEnableClickEvents;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::SetEnableMouseOverEvents;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::SetMousePosition;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::ConsoleCommand;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::SetPause;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::SetViewTarget;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::SetViewTargetWithBlend;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::AddYawInput;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::AddPitchInput;
-				Shared::PlayerControllerFunctions[head++] = (void*)&UnrealCLRFramework::PlayerController::AddRollInput;
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::IsPaused);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::GetShowMouseCursor);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::GetEnableClickEvents);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::GetEnableMouseOverEvents);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::GetMousePosition);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::GetPlayer);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::GetPlayerInput);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::GetHitResultAtScreenPosition);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::GetHitResultUnderCursor);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::SetShowMouseCursor);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::SetEnableClickEvents);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::SetEnableMouseOverEvents);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::SetMousePosition);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::ConsoleCommand);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::SetPause);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::SetViewTarget);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::SetViewTargetWithBlend);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::AddYawInput);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::AddPitchInput);
+				Shared::PlayerControllerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerController::AddRollInput);
 
 				checksum += head;
 			}
@@ -592,7 +705,7 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::VolumeFunctions;
 
-				Shared::VolumeFunctions[head++] = (void*)&UnrealCLRFramework::Volume::EncompassesPoint;
+				Shared::VolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Volume::EncompassesPoint);
 
 				checksum += head;
 			}
@@ -601,16 +714,16 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::PostProcessVolumeFunctions;
 
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::GetEnabled;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::GetBlendRadius;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::GetBlendWeight;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::GetUnbound;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::GetPriority;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::SetEnabled;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::SetBlendRadius;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::SetBlendWeight;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::SetUnbound;
-				Shared::PostProcessVolumeFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessVolume::SetPriority;
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::GetEnabled);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::GetBlendRadius);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::GetBlendWeight);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::GetUnbound);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::GetPriority);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::SetEnabled);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::SetBlendRadius);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::SetBlendWeight);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::SetUnbound);
+				Shared::PostProcessVolumeFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessVolume::SetPriority);
 
 				checksum += head;
 			}
@@ -619,7 +732,7 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::SoundBaseFunctions;
 
-				Shared::SoundBaseFunctions[head++] = (void*)&UnrealCLRFramework::SoundBase::GetDuration;
+				Shared::SoundBaseFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SoundBase::GetDuration);
 
 				checksum += head;
 			}
@@ -628,8 +741,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::SoundWaveFunctions;
 
-				Shared::SoundWaveFunctions[head++] = (void*)&UnrealCLRFramework::SoundWave::GetLoop;
-				Shared::SoundWaveFunctions[head++] = (void*)&UnrealCLRFramework::SoundWave::SetLoop;
+				Shared::SoundWaveFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SoundWave::GetLoop);
+				Shared::SoundWaveFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SoundWave::SetLoop);
 
 				checksum += head;
 			}
@@ -638,21 +751,21 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::AnimationInstanceFunctions;
 
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::GetCurrentActiveMontage;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::IsPlaying;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::GetPlayRate;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::GetPosition;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::GetBlendTime;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::GetCurrentSection;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::SetPlayRate;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::SetPosition;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::SetNextSection;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::PlayMontage;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::PauseMontage;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::ResumeMontage;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::StopMontage;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::JumpToSection;
-				Shared::AnimationInstanceFunctions[head++] = (void*)&UnrealCLRFramework::AnimationInstance::JumpToSectionsEnd;
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::GetCurrentActiveMontage);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::IsPlaying);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::GetPlayRate);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::GetPosition);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::GetBlendTime);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::GetCurrentSection);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::SetPlayRate);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::SetPosition);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::SetNextSection);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::PlayMontage);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::PauseMontage);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::ResumeMontage);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::StopMontage);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::JumpToSection);
+				Shared::AnimationInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AnimationInstance::JumpToSectionsEnd);
 
 				checksum += head;
 			}
@@ -661,7 +774,7 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::PlayerFunctions;
 
-				Shared::PlayerFunctions[head++] = (void*)&UnrealCLRFramework::Player::GetPlayerController;
+				Shared::PlayerFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Player::GetPlayerController);
 
 				checksum += head;
 			}
@@ -670,14 +783,14 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::PlayerInputFunctions;
 
-				Shared::PlayerInputFunctions[head++] = (void*)&UnrealCLRFramework::PlayerInput::IsKeyPressed;
-				Shared::PlayerInputFunctions[head++] = (void*)&UnrealCLRFramework::PlayerInput::GetTimeKeyPressed;
-				Shared::PlayerInputFunctions[head++] = (void*)&UnrealCLRFramework::PlayerInput::GetMouseSensitivity;
-				Shared::PlayerInputFunctions[head++] = (void*)&UnrealCLRFramework::PlayerInput::SetMouseSensitivity;
-				Shared::PlayerInputFunctions[head++] = (void*)&UnrealCLRFramework::PlayerInput::AddActionMapping;
-				Shared::PlayerInputFunctions[head++] = (void*)&UnrealCLRFramework::PlayerInput::AddAxisMapping;
-				Shared::PlayerInputFunctions[head++] = (void*)&UnrealCLRFramework::PlayerInput::RemoveActionMapping;
-				Shared::PlayerInputFunctions[head++] = (void*)&UnrealCLRFramework::PlayerInput::RemoveAxisMapping;
+				Shared::PlayerInputFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerInput::IsKeyPressed);
+				Shared::PlayerInputFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerInput::GetTimeKeyPressed);
+				Shared::PlayerInputFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerInput::GetMouseSensitivity);
+				Shared::PlayerInputFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerInput::SetMouseSensitivity);
+				Shared::PlayerInputFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerInput::AddActionMapping);
+				Shared::PlayerInputFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerInput::AddAxisMapping);
+				Shared::PlayerInputFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerInput::RemoveActionMapping);
+				Shared::PlayerInputFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PlayerInput::RemoveAxisMapping);
 
 				checksum += head;
 			}
@@ -686,7 +799,7 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::FontFunctions;
 
-				Shared::FontFunctions[head++] = (void*)&UnrealCLRFramework::Font::GetStringSize;
+				Shared::FontFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Font::GetStringSize);
 
 				checksum += head;
 			}
@@ -695,11 +808,11 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::Texture2DFunctions;
 
-				Shared::Texture2DFunctions[head++] = (void*)&UnrealCLRFramework::Texture2D::CreateFromFile;
-				Shared::Texture2DFunctions[head++] = (void*)&UnrealCLRFramework::Texture2D::CreateFromBuffer;
-				Shared::Texture2DFunctions[head++] = (void*)&UnrealCLRFramework::Texture2D::HasAlphaChannel;
-				Shared::Texture2DFunctions[head++] = (void*)&UnrealCLRFramework::Texture2D::GetSize;
-				Shared::Texture2DFunctions[head++] = (void*)&UnrealCLRFramework::Texture2D::GetPixelFormat;
+				Shared::Texture2DFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Texture2D::CreateFromFile);
+				Shared::Texture2DFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Texture2D::CreateFromBuffer);
+				Shared::Texture2DFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Texture2D::HasAlphaChannel);
+				Shared::Texture2DFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Texture2D::GetSize);
+				Shared::Texture2DFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Texture2D::GetPixelFormat);
 
 				checksum += head;
 			}
@@ -708,12 +821,12 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ActorComponentFunctions;
 
-				Shared::ActorComponentFunctions[head++] = (void*)&UnrealCLRFramework::ActorComponent::IsOwnerSelected;
-				Shared::ActorComponentFunctions[head++] = (void*)&UnrealCLRFramework::ActorComponent::GetOwner;
-				Shared::ActorComponentFunctions[head++] = (void*)&UnrealCLRFramework::ActorComponent::Destroy;
-				Shared::ActorComponentFunctions[head++] = (void*)&UnrealCLRFramework::ActorComponent::AddTag;
-				Shared::ActorComponentFunctions[head++] = (void*)&UnrealCLRFramework::ActorComponent::RemoveTag;
-				Shared::ActorComponentFunctions[head++] = (void*)&UnrealCLRFramework::ActorComponent::HasTag;
+				Shared::ActorComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorComponent::IsOwnerSelected);
+				Shared::ActorComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorComponent::GetOwner);
+				Shared::ActorComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorComponent::Destroy);
+				Shared::ActorComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorComponent::AddTag);
+				Shared::ActorComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorComponent::RemoveTag);
+				Shared::ActorComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ActorComponent::HasTag);
 
 				checksum += head;
 			}
@@ -722,16 +835,16 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::InputComponentFunctions;
 
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::HasBindings;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::GetActionBindingsNumber;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::ClearActionBindings;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::BindAction;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::BindAxis;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::RemoveActionBinding;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::GetBlockInput;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::SetBlockInput;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::GetPriority;
-				Shared::InputComponentFunctions[head++] = (void*)&UnrealCLRFramework::InputComponent::SetPriority;
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::HasBindings);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::GetActionBindingsNumber);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::ClearActionBindings);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::BindAction);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::BindAxis);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::RemoveActionBinding);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::GetBlockInput);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::SetBlockInput);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::GetPriority);
+				Shared::InputComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InputComponent::SetPriority);
 
 				checksum += head;
 			}
@@ -740,29 +853,29 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::MovementComponentFunctions;
 
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetConstrainToPlane;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetSnapToPlaneAtStart;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetVelocity;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetPlaneConstraint;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetUpdateOnlyIfRendered;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetPlaneConstraintNormal;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetPlaneConstraintOrigin;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetGravity;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::GetMaxSpeed;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::SetConstrainToPlane;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::SetSnapToPlaneAtStart;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::SetUpdateOnlyIfRendered;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::SetVelocity;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::SetPlaneConstraint;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::SetPlaneConstraintNormal;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::SetPlaneConstraintOrigin;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::SetPlaneConstraintFromVectors;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::IsExceedingMaxSpeed;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::IsInWater;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::StopMovement;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::ConstrainDirectionToPlane;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::ConstrainLocationToPlane;
-				Shared::MovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::MovementComponent::ConstrainNormalToPlane;
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetConstrainToPlane);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetSnapToPlaneAtStart);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetVelocity);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetPlaneConstraint);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetUpdateOnlyIfRendered);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetPlaneConstraintNormal);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetPlaneConstraintOrigin);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetGravity);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::GetMaxSpeed);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::SetConstrainToPlane);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::SetSnapToPlaneAtStart);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::SetUpdateOnlyIfRendered);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::SetVelocity);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::SetPlaneConstraint);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::SetPlaneConstraintNormal);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::SetPlaneConstraintOrigin);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::SetPlaneConstraintFromVectors);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::IsExceedingMaxSpeed);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::IsInWater);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::StopMovement);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::ConstrainDirectionToPlane);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::ConstrainLocationToPlane);
+				Shared::MovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MovementComponent::ConstrainNormalToPlane);
 
 				checksum += head;
 			}
@@ -771,13 +884,13 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::RotatingMovementComponentFunctions;
 
-				Shared::RotatingMovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::RotatingMovementComponent::Create;
-				Shared::RotatingMovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::RotatingMovementComponent::GetRotationInLocalSpace;
-				Shared::RotatingMovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::RotatingMovementComponent::GetPivotTranslation;
-				Shared::RotatingMovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::RotatingMovementComponent::GetRotationRate;
-				Shared::RotatingMovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::RotatingMovementComponent::SetRotationInLocalSpace;
-				Shared::RotatingMovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::RotatingMovementComponent::SetPivotTranslation;
-				Shared::RotatingMovementComponentFunctions[head++] = (void*)&UnrealCLRFramework::RotatingMovementComponent::SetRotationRate;
+				Shared::RotatingMovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RotatingMovementComponent::Create);
+				Shared::RotatingMovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RotatingMovementComponent::GetRotationInLocalSpace);
+				Shared::RotatingMovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RotatingMovementComponent::GetPivotTranslation);
+				Shared::RotatingMovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RotatingMovementComponent::GetRotationRate);
+				Shared::RotatingMovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RotatingMovementComponent::SetRotationInLocalSpace);
+				Shared::RotatingMovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RotatingMovementComponent::SetPivotTranslation);
+				Shared::RotatingMovementComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RotatingMovementComponent::SetRotationRate);
 
 				checksum += head;
 			}
@@ -786,48 +899,54 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::SceneComponentFunctions;
 
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::IsAttachedToComponent;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::IsAttachedToActor;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::IsVisible;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::IsSocketExists;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::HasAnySockets;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::CanAttachAsChild;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::ForEachAttachedChild;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::Create;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AttachToComponent;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::DetachFromComponent;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::Activate;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::Deactivate;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::UpdateToWorld;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AddLocalOffset;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AddLocalRotation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AddRelativeLocation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AddRelativeRotation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AddLocalTransform;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AddWorldOffset;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AddWorldRotation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::AddWorldTransform;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetAttachedSocketName;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetBounds;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetSocketLocation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetSocketRotation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetComponentVelocity;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetComponentLocation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetComponentRotation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetComponentScale;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetComponentTransform;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetForwardVector;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetRightVector;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::GetUpVector;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetMobility;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetVisibility;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetRelativeLocation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetRelativeRotation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetRelativeTransform;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetWorldLocation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetWorldRotation;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetWorldScale;
-				Shared::SceneComponentFunctions[head++] = (void*)&UnrealCLRFramework::SceneComponent::SetWorldTransform;
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::IsAttachedToComponent);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::IsAttachedToActor);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::IsVisible);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::IsSocketExists);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::HasAnySockets);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::CanAttachAsChild);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::ForEachAttachedChild);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::Create);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AttachToComponent);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::DetachFromComponent);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::Activate);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::Deactivate);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::UpdateToWorld);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AddLocalOffset);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AddLocalRotation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AddRelativeLocation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AddRelativeRotation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AddLocalTransform);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AddWorldOffset);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AddWorldRotation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::AddWorldTransform);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetAttachedSocketName);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetBounds);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetSocketLocation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetSocketRotation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetComponentVelocity);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetComponentLocation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetComponentRotation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetComponentScale);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetComponentTransform);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetForwardVector);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetRightVector);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetUpVector);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetMobility);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetVisibility);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetRelativeLocation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetRelativeRotation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetRelativeTransform);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetWorldLocation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetWorldRotation);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetWorldScale);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetWorldTransform);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetComponentTransforms);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetComponentLocations);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::GetComponentLocationsSeparated);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetWorldTransforms);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetWorldLocations);
+				Shared::SceneComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SceneComponent::SetRelativeTransforms);
 
 				checksum += head;
 			}
@@ -836,14 +955,14 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::AudioComponentFunctions;
 
-				Shared::AudioComponentFunctions[head++] = (void*)&UnrealCLRFramework::AudioComponent::IsPlaying;
-				Shared::AudioComponentFunctions[head++] = (void*)&UnrealCLRFramework::AudioComponent::GetPaused;
-				Shared::AudioComponentFunctions[head++] = (void*)&UnrealCLRFramework::AudioComponent::SetSound;
-				Shared::AudioComponentFunctions[head++] = (void*)&UnrealCLRFramework::AudioComponent::SetPaused;
-				Shared::AudioComponentFunctions[head++] = (void*)&UnrealCLRFramework::AudioComponent::Play;
-				Shared::AudioComponentFunctions[head++] = (void*)&UnrealCLRFramework::AudioComponent::Stop;
-				Shared::AudioComponentFunctions[head++] = (void*)&UnrealCLRFramework::AudioComponent::FadeIn;
-				Shared::AudioComponentFunctions[head++] = (void*)&UnrealCLRFramework::AudioComponent::FadeOut;
+				Shared::AudioComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AudioComponent::IsPlaying);
+				Shared::AudioComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AudioComponent::GetPaused);
+				Shared::AudioComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AudioComponent::SetSound);
+				Shared::AudioComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AudioComponent::SetPaused);
+				Shared::AudioComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AudioComponent::Play);
+				Shared::AudioComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AudioComponent::Stop);
+				Shared::AudioComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AudioComponent::FadeIn);
+				Shared::AudioComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::AudioComponent::FadeOut);
 
 				checksum += head;
 			}
@@ -852,21 +971,21 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::CameraComponentFunctions;
 
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::GetConstrainAspectRatio;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::GetAspectRatio;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::GetFieldOfView;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::GetOrthoFarClipPlane;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::GetOrthoNearClipPlane;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::GetOrthoWidth;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::GetLockToHeadMountedDisplay;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::SetProjectionMode;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::SetConstrainAspectRatio;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::SetAspectRatio;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::SetFieldOfView;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::SetOrthoFarClipPlane;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::SetOrthoNearClipPlane;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::SetOrthoWidth;
-				Shared::CameraComponentFunctions[head++] = (void*)&UnrealCLRFramework::CameraComponent::SetLockToHeadMountedDisplay;
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::GetConstrainAspectRatio);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::GetAspectRatio);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::GetFieldOfView);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::GetOrthoFarClipPlane);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::GetOrthoNearClipPlane);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::GetOrthoWidth);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::GetLockToHeadMountedDisplay);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::SetProjectionMode);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::SetConstrainAspectRatio);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::SetAspectRatio);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::SetFieldOfView);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::SetOrthoFarClipPlane);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::SetOrthoNearClipPlane);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::SetOrthoWidth);
+				Shared::CameraComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CameraComponent::SetLockToHeadMountedDisplay);
 
 				checksum += head;
 			}
@@ -875,8 +994,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ChildActorComponentFunctions;
 
-				Shared::ChildActorComponentFunctions[head++] = (void*)&UnrealCLRFramework::ChildActorComponent::GetChildActor;
-				Shared::ChildActorComponentFunctions[head++] = (void*)&UnrealCLRFramework::ChildActorComponent::SetChildActor;
+				Shared::ChildActorComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ChildActorComponent::GetChildActor);
+				Shared::ChildActorComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ChildActorComponent::SetChildActor);
 
 				checksum += head;
 			}
@@ -885,46 +1004,46 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::SpringArmComponentFunctions;
 
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::IsCollisionFixApplied;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetDrawDebugLagMarkers;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetCollisionTest;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetCameraPositionLag;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetCameraRotationLag;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetCameraLagSubstepping;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetInheritPitch;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetInheritRoll;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetInheritYaw;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetCameraLagMaxDistance;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetCameraLagMaxTimeStep;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetCameraPositionLagSpeed;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetCameraRotationLagSpeed;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetProbeChannel;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetProbeSize;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetSocketOffset;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetTargetArmLength;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetTargetOffset;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetUnfixedCameraPosition;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetDesiredRotation;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetTargetRotation;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::GetUsePawnControlRotation;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetDrawDebugLagMarkers;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetCollisionTest;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetCameraPositionLag;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetCameraRotationLag;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetCameraLagSubstepping;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetInheritPitch;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetInheritRoll;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetInheritYaw;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetCameraLagMaxDistance;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetCameraLagMaxTimeStep;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetCameraPositionLagSpeed;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetCameraRotationLagSpeed;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetProbeChannel;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetProbeSize;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetSocketOffset;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetTargetArmLength;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetTargetOffset;
-				Shared::SpringArmComponentFunctions[head++] = (void*)&UnrealCLRFramework::SpringArmComponent::SetUsePawnControlRotation;
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::IsCollisionFixApplied);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetDrawDebugLagMarkers);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetCollisionTest);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetCameraPositionLag);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetCameraRotationLag);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetCameraLagSubstepping);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetInheritPitch);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetInheritRoll);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetInheritYaw);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetCameraLagMaxDistance);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetCameraLagMaxTimeStep);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetCameraPositionLagSpeed);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetCameraRotationLagSpeed);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetProbeChannel);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetProbeSize);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetSocketOffset);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetTargetArmLength);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetTargetOffset);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetUnfixedCameraPosition);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetDesiredRotation);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetTargetRotation);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::GetUsePawnControlRotation);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetDrawDebugLagMarkers);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetCollisionTest);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetCameraPositionLag);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetCameraRotationLag);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetCameraLagSubstepping);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetInheritPitch);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetInheritRoll);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetInheritYaw);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetCameraLagMaxDistance);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetCameraLagMaxTimeStep);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetCameraPositionLagSpeed);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetCameraRotationLagSpeed);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetProbeChannel);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetProbeSize);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetSocketOffset);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetTargetArmLength);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetTargetOffset);
+				Shared::SpringArmComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SpringArmComponent::SetUsePawnControlRotation);
 
 				checksum += head;
 			}
@@ -933,16 +1052,16 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::PostProcessComponentFunctions;
 
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::GetEnabled;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::GetBlendRadius;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::GetBlendWeight;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::GetUnbound;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::GetPriority;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::SetEnabled;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::SetBlendRadius;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::SetBlendWeight;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::SetUnbound;
-				Shared::PostProcessComponentFunctions[head++] = (void*)&UnrealCLRFramework::PostProcessComponent::SetPriority;
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::GetEnabled);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::GetBlendRadius);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::GetBlendWeight);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::GetUnbound);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::GetPriority);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::SetEnabled);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::SetBlendRadius);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::SetBlendWeight);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::SetUnbound);
+				Shared::PostProcessComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PostProcessComponent::SetPriority);
 
 				checksum += head;
 			}
@@ -951,66 +1070,66 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::PrimitiveComponentFunctions;
 
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::IsGravityEnabled;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::IsOverlappingComponent;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::ForEachOverlappingComponent;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddAngularImpulseInDegrees;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddAngularImpulseInRadians;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddForce;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddForceAtLocation;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddImpulse;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddImpulseAtLocation;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddRadialForce;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddRadialImpulse;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddTorqueInDegrees;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::AddTorqueInRadians;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetMass;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetPhysicsLinearVelocity;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetPhysicsLinearVelocityAtPoint;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetPhysicsAngularVelocityInDegrees;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetPhysicsAngularVelocityInRadians;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetCastShadow;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetOnlyOwnerSee;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetOwnerNoSee;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetIgnoreRadialForce;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetIgnoreRadialImpulse;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetMaterial;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetMaterialsNumber;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetDistanceToCollision;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetSquaredDistanceToCollision;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetAngularDamping;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::GetLinearDamping;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetGenerateOverlapEvents;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetGenerateHitEvents;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetMass;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetCenterOfMass;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetPhysicsLinearVelocity;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetPhysicsAngularVelocityInDegrees;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetPhysicsAngularVelocityInRadians;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetPhysicsMaxAngularVelocityInDegrees;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetPhysicsMaxAngularVelocityInRadians;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetCastShadow;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetOnlyOwnerSee;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetOwnerNoSee;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetIgnoreRadialForce;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetIgnoreRadialImpulse;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetMaterial;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetSimulatePhysics;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetAngularDamping;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetLinearDamping;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetEnableGravity;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetCollisionMode;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetCollisionChannel;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetCollisionProfileName;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetCollisionResponseToChannel;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetCollisionResponseToAllChannels;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetIgnoreActorWhenMoving;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::SetIgnoreComponentWhenMoving;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::ClearMoveIgnoreActors;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::ClearMoveIgnoreComponents;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::CreateAndSetMaterialInstanceDynamic;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::RegisterEvent;
-				Shared::PrimitiveComponentFunctions[head++] = (void*)&UnrealCLRFramework::PrimitiveComponent::UnregisterEvent;
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::IsGravityEnabled);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::IsOverlappingComponent);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::ForEachOverlappingComponent);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddAngularImpulseInDegrees);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddAngularImpulseInRadians);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddForce);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddForceAtLocation);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddImpulse);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddImpulseAtLocation);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddRadialForce);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddRadialImpulse);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddTorqueInDegrees);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::AddTorqueInRadians);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetMass);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetPhysicsLinearVelocity);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetPhysicsLinearVelocityAtPoint);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetPhysicsAngularVelocityInDegrees);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetPhysicsAngularVelocityInRadians);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetCastShadow);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetOnlyOwnerSee);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetOwnerNoSee);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetIgnoreRadialForce);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetIgnoreRadialImpulse);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetMaterial);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetMaterialsNumber);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetDistanceToCollision);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetSquaredDistanceToCollision);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetAngularDamping);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::GetLinearDamping);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetGenerateOverlapEvents);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetGenerateHitEvents);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetMass);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetCenterOfMass);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetPhysicsLinearVelocity);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetPhysicsAngularVelocityInDegrees);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetPhysicsAngularVelocityInRadians);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetPhysicsMaxAngularVelocityInDegrees);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetPhysicsMaxAngularVelocityInRadians);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetCastShadow);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetOnlyOwnerSee);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetOwnerNoSee);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetIgnoreRadialForce);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetIgnoreRadialImpulse);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetMaterial);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetSimulatePhysics);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetAngularDamping);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetLinearDamping);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetEnableGravity);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetCollisionMode);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetCollisionChannel);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetCollisionProfileName);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetCollisionResponseToChannel);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetCollisionResponseToAllChannels);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetIgnoreActorWhenMoving);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::SetIgnoreComponentWhenMoving);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::ClearMoveIgnoreActors);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::ClearMoveIgnoreComponents);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::CreateAndSetMaterialInstanceDynamic);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::RegisterEvent);
+				Shared::PrimitiveComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::PrimitiveComponent::UnregisterEvent);
 
 				checksum += head;
 			}
@@ -1019,10 +1138,10 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ShapeComponentFunctions;
 
-				Shared::ShapeComponentFunctions[head++] = (void*)&UnrealCLRFramework::ShapeComponent::GetDynamicObstacle;
-				Shared::ShapeComponentFunctions[head++] = (void*)&UnrealCLRFramework::ShapeComponent::GetShapeColor;
-				Shared::ShapeComponentFunctions[head++] = (void*)&UnrealCLRFramework::ShapeComponent::SetDynamicObstacle;
-				Shared::ShapeComponentFunctions[head++] = (void*)&UnrealCLRFramework::ShapeComponent::SetShapeColor;
+				Shared::ShapeComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ShapeComponent::GetDynamicObstacle);
+				Shared::ShapeComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ShapeComponent::GetShapeColor);
+				Shared::ShapeComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ShapeComponent::SetDynamicObstacle);
+				Shared::ShapeComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::ShapeComponent::SetShapeColor);
 
 				checksum += head;
 			}
@@ -1031,10 +1150,10 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::BoxComponentFunctions;
 
-				Shared::BoxComponentFunctions[head++] = (void*)&UnrealCLRFramework::BoxComponent::GetScaledBoxExtent;
-				Shared::BoxComponentFunctions[head++] = (void*)&UnrealCLRFramework::BoxComponent::GetUnscaledBoxExtent;
-				Shared::BoxComponentFunctions[head++] = (void*)&UnrealCLRFramework::BoxComponent::SetBoxExtent;
-				Shared::BoxComponentFunctions[head++] = (void*)&UnrealCLRFramework::BoxComponent::InitBoxExtent;
+				Shared::BoxComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::BoxComponent::GetScaledBoxExtent);
+				Shared::BoxComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::BoxComponent::GetUnscaledBoxExtent);
+				Shared::BoxComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::BoxComponent::SetBoxExtent);
+				Shared::BoxComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::BoxComponent::InitBoxExtent);
 
 				checksum += head;
 			}
@@ -1043,11 +1162,11 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::SphereComponentFunctions;
 
-				Shared::SphereComponentFunctions[head++] = (void*)&UnrealCLRFramework::SphereComponent::GetScaledSphereRadius;
-				Shared::SphereComponentFunctions[head++] = (void*)&UnrealCLRFramework::SphereComponent::GetUnscaledSphereRadius;
-				Shared::SphereComponentFunctions[head++] = (void*)&UnrealCLRFramework::SphereComponent::GetShapeScale;
-				Shared::SphereComponentFunctions[head++] = (void*)&UnrealCLRFramework::SphereComponent::SetSphereRadius;
-				Shared::SphereComponentFunctions[head++] = (void*)&UnrealCLRFramework::SphereComponent::InitSphereRadius;
+				Shared::SphereComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SphereComponent::GetScaledSphereRadius);
+				Shared::SphereComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SphereComponent::GetUnscaledSphereRadius);
+				Shared::SphereComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SphereComponent::GetShapeScale);
+				Shared::SphereComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SphereComponent::SetSphereRadius);
+				Shared::SphereComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SphereComponent::InitSphereRadius);
 
 				checksum += head;
 			}
@@ -1056,14 +1175,14 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::CapsuleComponentFunctions;
 
-				Shared::CapsuleComponentFunctions[head++] = (void*)&UnrealCLRFramework::CapsuleComponent::GetScaledCapsuleRadius;
-				Shared::CapsuleComponentFunctions[head++] = (void*)&UnrealCLRFramework::CapsuleComponent::GetUnscaledCapsuleRadius;
-				Shared::CapsuleComponentFunctions[head++] = (void*)&UnrealCLRFramework::CapsuleComponent::GetShapeScale;
-				Shared::CapsuleComponentFunctions[head++] = (void*)&UnrealCLRFramework::CapsuleComponent::GetScaledCapsuleSize;
-				Shared::CapsuleComponentFunctions[head++] = (void*)&UnrealCLRFramework::CapsuleComponent::GetUnscaledCapsuleSize;
-				Shared::CapsuleComponentFunctions[head++] = (void*)&UnrealCLRFramework::CapsuleComponent::SetCapsuleRadius;
-				Shared::CapsuleComponentFunctions[head++] = (void*)&UnrealCLRFramework::CapsuleComponent::SetCapsuleSize;
-				Shared::CapsuleComponentFunctions[head++] = (void*)&UnrealCLRFramework::CapsuleComponent::InitCapsuleSize;
+				Shared::CapsuleComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CapsuleComponent::GetScaledCapsuleRadius);
+				Shared::CapsuleComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CapsuleComponent::GetUnscaledCapsuleRadius);
+				Shared::CapsuleComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CapsuleComponent::GetShapeScale);
+				Shared::CapsuleComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CapsuleComponent::GetScaledCapsuleSize);
+				Shared::CapsuleComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CapsuleComponent::GetUnscaledCapsuleSize);
+				Shared::CapsuleComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CapsuleComponent::SetCapsuleRadius);
+				Shared::CapsuleComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CapsuleComponent::SetCapsuleSize);
+				Shared::CapsuleComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::CapsuleComponent::InitCapsuleSize);
 
 				checksum += head;
 			}
@@ -1072,8 +1191,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::MeshComponentFunctions;
 
-				Shared::MeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::MeshComponent::IsValidMaterialSlotName;
-				Shared::MeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::MeshComponent::GetMaterialIndex;
+				Shared::MeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MeshComponent::IsValidMaterialSlotName);
+				Shared::MeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MeshComponent::GetMaterialIndex);
 
 				checksum += head;
 			}
@@ -1082,16 +1201,16 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::TextRenderComponentFunctions;
 
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetFont;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetText;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetTextMaterial;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetTextRenderColor;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetHorizontalAlignment;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetHorizontalSpacingAdjustment;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetVerticalAlignment;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetVerticalSpacingAdjustment;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetScale;
-				Shared::TextRenderComponentFunctions[head++] = (void*)&UnrealCLRFramework::TextRenderComponent::SetWorldSize;
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetFont);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetText);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetTextMaterial);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetTextRenderColor);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetHorizontalAlignment);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetHorizontalSpacingAdjustment);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetVerticalAlignment);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetVerticalSpacingAdjustment);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetScale);
+				Shared::TextRenderComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::TextRenderComponent::SetWorldSize);
 
 				checksum += head;
 			}
@@ -1100,9 +1219,9 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::LightComponentBaseFunctions;
 
-				Shared::LightComponentBaseFunctions[head++] = (void*)&UnrealCLRFramework::LightComponentBase::GetIntensity;
-				Shared::LightComponentBaseFunctions[head++] = (void*)&UnrealCLRFramework::LightComponentBase::GetCastShadows;
-				Shared::LightComponentBaseFunctions[head++] = (void*)&UnrealCLRFramework::LightComponentBase::SetCastShadows;
+				Shared::LightComponentBaseFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::LightComponentBase::GetIntensity);
+				Shared::LightComponentBaseFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::LightComponentBase::GetCastShadows);
+				Shared::LightComponentBaseFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::LightComponentBase::SetCastShadows);
 
 				checksum += head;
 			}
@@ -1111,8 +1230,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::LightComponentFunctions;
 
-				Shared::LightComponentFunctions[head++] = (void*)&UnrealCLRFramework::LightComponent::SetIntensity;
-				Shared::LightComponentFunctions[head++] = (void*)&UnrealCLRFramework::LightComponent::SetLightColor;
+				Shared::LightComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::LightComponent::SetIntensity);
+				Shared::LightComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::LightComponent::SetLightColor);
 
 				checksum += head;
 			}
@@ -1121,17 +1240,17 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::MotionControllerComponentFunctions;
 
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::IsTracked;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::GetDisplayDeviceModel;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::GetDisableLowLatencyUpdate;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::GetTrackingSource;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::SetDisplayDeviceModel;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::SetDisableLowLatencyUpdate;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::SetTrackingSource;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::SetTrackingMotionSource;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::SetAssociatedPlayerIndex;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::SetCustomDisplayMesh;
-				Shared::MotionControllerComponentFunctions[head++] = (void*)&UnrealCLRFramework::MotionControllerComponent::SetDisplayModelSource;
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::IsTracked);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::GetDisplayDeviceModel);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::GetDisableLowLatencyUpdate);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::GetTrackingSource);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::SetDisplayDeviceModel);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::SetDisableLowLatencyUpdate);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::SetTrackingSource);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::SetTrackingMotionSource);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::SetAssociatedPlayerIndex);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::SetCustomDisplayMesh);
+				Shared::MotionControllerComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MotionControllerComponent::SetDisplayModelSource);
 
 				checksum += head;
 			}
@@ -1140,9 +1259,9 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::StaticMeshComponentFunctions;
 
-				Shared::StaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::StaticMeshComponent::GetLocalBounds;
-				Shared::StaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::StaticMeshComponent::GetStaticMesh;
-				Shared::StaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::StaticMeshComponent::SetStaticMesh;
+				Shared::StaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::StaticMeshComponent::GetLocalBounds);
+				Shared::StaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::StaticMeshComponent::GetStaticMesh);
+				Shared::StaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::StaticMeshComponent::SetStaticMesh);
 
 				checksum += head;
 			}
@@ -1151,14 +1270,14 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::InstancedStaticMeshComponentFunctions;
 
-				Shared::InstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::InstancedStaticMeshComponent::GetInstanceCount;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::InstancedStaticMeshComponent::GetInstanceTransform;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::InstancedStaticMeshComponent::AddInstance;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::InstancedStaticMeshComponent::AddInstances;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::InstancedStaticMeshComponent::UpdateInstanceTransform;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::InstancedStaticMeshComponent::BatchUpdateInstanceTransforms;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::InstancedStaticMeshComponent::RemoveInstance;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::InstancedStaticMeshComponent::ClearInstances;
+				Shared::InstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InstancedStaticMeshComponent::GetInstanceCount);
+				Shared::InstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InstancedStaticMeshComponent::GetInstanceTransform);
+				Shared::InstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InstancedStaticMeshComponent::AddInstance);
+				Shared::InstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InstancedStaticMeshComponent::AddInstances);
+				Shared::InstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InstancedStaticMeshComponent::UpdateInstanceTransform);
+				Shared::InstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InstancedStaticMeshComponent::BatchUpdateInstanceTransforms);
+				Shared::InstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InstancedStaticMeshComponent::RemoveInstance);
+				Shared::InstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::InstancedStaticMeshComponent::ClearInstances);
 
 				checksum += head;
 			}
@@ -1167,8 +1286,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::HierarchicalInstancedStaticMeshComponentFunctions;
 
-				Shared::HierarchicalInstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::HierarchicalInstancedStaticMeshComponent::GetDisableCollision;
-				Shared::HierarchicalInstancedStaticMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::HierarchicalInstancedStaticMeshComponent::SetDisableCollision;
+				Shared::HierarchicalInstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::HierarchicalInstancedStaticMeshComponent::GetDisableCollision);
+				Shared::HierarchicalInstancedStaticMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::HierarchicalInstancedStaticMeshComponent::SetDisableCollision);
 
 				checksum += head;
 			}
@@ -1177,11 +1296,11 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::SkinnedMeshComponentFunctions;
 
-				Shared::SkinnedMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkinnedMeshComponent::GetBonesNumber;
-				Shared::SkinnedMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkinnedMeshComponent::GetBoneIndex;
-				Shared::SkinnedMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkinnedMeshComponent::GetBoneName;
-				Shared::SkinnedMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkinnedMeshComponent::GetBoneTransform;
-				Shared::SkinnedMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkinnedMeshComponent::SetSkeletalMesh;
+				Shared::SkinnedMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkinnedMeshComponent::GetBonesNumber);
+				Shared::SkinnedMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkinnedMeshComponent::GetBoneIndex);
+				Shared::SkinnedMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkinnedMeshComponent::GetBoneName);
+				Shared::SkinnedMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkinnedMeshComponent::GetBoneTransform);
+				Shared::SkinnedMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkinnedMeshComponent::SetSkeletalMesh);
 
 				checksum += head;
 			}
@@ -1190,14 +1309,14 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::SkeletalMeshComponentFunctions;
 
-				Shared::SkeletalMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkeletalMeshComponent::IsPlaying;
-				Shared::SkeletalMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkeletalMeshComponent::GetAnimationInstance;
-				Shared::SkeletalMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkeletalMeshComponent::SetAnimation;
-				Shared::SkeletalMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkeletalMeshComponent::SetAnimationMode;
-				Shared::SkeletalMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkeletalMeshComponent::SetAnimationBlueprint;
-				Shared::SkeletalMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkeletalMeshComponent::Play;
-				Shared::SkeletalMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkeletalMeshComponent::PlayAnimation;
-				Shared::SkeletalMeshComponentFunctions[head++] = (void*)&UnrealCLRFramework::SkeletalMeshComponent::Stop;
+				Shared::SkeletalMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkeletalMeshComponent::IsPlaying);
+				Shared::SkeletalMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkeletalMeshComponent::GetAnimationInstance);
+				Shared::SkeletalMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkeletalMeshComponent::SetAnimation);
+				Shared::SkeletalMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkeletalMeshComponent::SetAnimationMode);
+				Shared::SkeletalMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkeletalMeshComponent::SetAnimationBlueprint);
+				Shared::SkeletalMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkeletalMeshComponent::Play);
+				Shared::SkeletalMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkeletalMeshComponent::PlayAnimation);
+				Shared::SkeletalMeshComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SkeletalMeshComponent::Stop);
 
 				checksum += head;
 			}
@@ -1206,65 +1325,65 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::SplineComponentFunctions;
 
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::IsClosedLoop;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetDuration;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetSplinePointType;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetSplinePointsNumber;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetSplineSegmentsNumber;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetTangentAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetTangentAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetTangentAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetTransformAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetTransformAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetArriveTangentAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetDefaultUpVector;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetDirectionAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetDirectionAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetDirectionAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetDistanceAlongSplineAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetLeaveTangentAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetLocationAndTangentAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetLocationAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetLocationAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetLocationAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRightVectorAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRightVectorAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRightVectorAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRollAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRollAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRollAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRotationAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRotationAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetRotationAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetScaleAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetScaleAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetScaleAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetSplineLength;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetTransformAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetUpVectorAtDistanceAlongSpline;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetUpVectorAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::GetUpVectorAtTime;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::SetDuration;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::SetSplinePointType;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::SetClosedLoop;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::SetDefaultUpVector;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::SetLocationAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::SetTangentAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::SetTangentsAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::SetUpVectorAtSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::AddSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::AddSplinePointAtIndex;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::ClearSplinePoints;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::FindDirectionClosestToWorldLocation;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::FindLocationClosestToWorldLocation;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::FindUpVectorClosestToWorldLocation;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::FindRightVectorClosestToWorldLocation;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::FindRollClosestToWorldLocation;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::FindScaleClosestToWorldLocation;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::FindTangentClosestToWorldLocation;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::FindTransformClosestToWorldLocation;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::RemoveSplinePoint;
-				Shared::SplineComponentFunctions[head++] = (void*)&UnrealCLRFramework::SplineComponent::UpdateSpline;
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::IsClosedLoop);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetDuration);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetSplinePointType);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetSplinePointsNumber);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetSplineSegmentsNumber);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetTangentAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetTangentAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetTangentAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetTransformAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetTransformAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetArriveTangentAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetDefaultUpVector);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetDirectionAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetDirectionAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetDirectionAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetDistanceAlongSplineAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetLeaveTangentAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetLocationAndTangentAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetLocationAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetLocationAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetLocationAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRightVectorAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRightVectorAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRightVectorAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRollAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRollAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRollAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRotationAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRotationAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetRotationAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetScaleAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetScaleAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetScaleAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetSplineLength);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetTransformAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetUpVectorAtDistanceAlongSpline);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetUpVectorAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::GetUpVectorAtTime);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::SetDuration);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::SetSplinePointType);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::SetClosedLoop);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::SetDefaultUpVector);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::SetLocationAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::SetTangentAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::SetTangentsAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::SetUpVectorAtSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::AddSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::AddSplinePointAtIndex);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::ClearSplinePoints);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::FindDirectionClosestToWorldLocation);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::FindLocationClosestToWorldLocation);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::FindUpVectorClosestToWorldLocation);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::FindRightVectorClosestToWorldLocation);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::FindRollClosestToWorldLocation);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::FindScaleClosestToWorldLocation);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::FindTangentClosestToWorldLocation);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::FindTransformClosestToWorldLocation);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::RemoveSplinePoint);
+				Shared::SplineComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::SplineComponent::UpdateSpline);
 
 				checksum += head;
 			}
@@ -1273,20 +1392,20 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::RadialForceComponentFunctions;
 
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::GetIgnoreOwningActor;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::GetImpulseVelocityChange;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::GetLinearFalloff;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::GetForceStrength;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::GetImpulseStrength;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::GetRadius;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::SetIgnoreOwningActor;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::SetImpulseVelocityChange;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::SetLinearFalloff;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::SetForceStrength;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::SetImpulseStrength;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::SetRadius;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::AddCollisionChannelToAffect;
-				Shared::RadialForceComponentFunctions[head++] = (void*)&UnrealCLRFramework::RadialForceComponent::FireImpulse;
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::GetIgnoreOwningActor);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::GetImpulseVelocityChange);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::GetLinearFalloff);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::GetForceStrength);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::GetImpulseStrength);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::GetRadius);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::SetIgnoreOwningActor);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::SetImpulseVelocityChange);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::SetLinearFalloff);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::SetForceStrength);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::SetImpulseStrength);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::SetRadius);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::AddCollisionChannelToAffect);
+				Shared::RadialForceComponentFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::RadialForceComponent::FireImpulse);
 
 				checksum += head;
 			}
@@ -1295,7 +1414,7 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::MaterialInterfaceFunctions;
 
-				Shared::MaterialInterfaceFunctions[head++] = (void*)&UnrealCLRFramework::MaterialInterface::IsTwoSided;
+				Shared::MaterialInterfaceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MaterialInterface::IsTwoSided);
 
 				checksum += head;
 			}
@@ -1304,7 +1423,7 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::MaterialFunctions;
 
-				Shared::MaterialFunctions[head++] = (void*)&UnrealCLRFramework::Material::IsDefaultMaterial;
+				Shared::MaterialFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::Material::IsDefaultMaterial);
 
 				checksum += head;
 			}
@@ -1313,8 +1432,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::MaterialInstanceFunctions;
 
-				Shared::MaterialInstanceFunctions[head++] = (void*)&UnrealCLRFramework::MaterialInstance::IsChildOf;
-				Shared::MaterialInstanceFunctions[head++] = (void*)&UnrealCLRFramework::MaterialInstance::GetParent;
+				Shared::MaterialInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MaterialInstance::IsChildOf);
+				Shared::MaterialInstanceFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MaterialInstance::GetParent);
 
 				checksum += head;
 			}
@@ -1323,16 +1442,20 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::MaterialInstanceDynamicFunctions;
 
-				Shared::MaterialInstanceDynamicFunctions[head++] = (void*)&UnrealCLRFramework::MaterialInstanceDynamic::ClearParameterValues;
-				Shared::MaterialInstanceDynamicFunctions[head++] = (void*)&UnrealCLRFramework::MaterialInstanceDynamic::SetTextureParameterValue;
-				Shared::MaterialInstanceDynamicFunctions[head++] = (void*)&UnrealCLRFramework::MaterialInstanceDynamic::SetVectorParameterValue;
-				Shared::MaterialInstanceDynamicFunctions[head++] = (void*)&UnrealCLRFramework::MaterialInstanceDynamic::SetScalarParameterValue;
+				Shared::MaterialInstanceDynamicFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MaterialInstanceDynamic::ClearParameterValues);
+				Shared::MaterialInstanceDynamicFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MaterialInstanceDynamic::SetTextureParameterValue);
+				Shared::MaterialInstanceDynamicFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MaterialInstanceDynamic::SetVectorParameterValue);
+				Shared::MaterialInstanceDynamicFunctions[head++] = UNREALCLR_FUNCTION(UnrealCLRFramework::MaterialInstanceDynamic::SetScalarParameterValue);
 
 				checksum += head;
 			}
 
 			checksum += position;
 
+			#if UNREALCLR_PROFILER
+				UnrealCLR::Profiler::RegisterCommands();
+			#endif
+
 			// Runtime pointers
 
 			Shared::RuntimeFunctions[0] = (void*)&UnrealCLR::Module::Exception;
@@ -1366,6 +1489,10 @@ void UnrealCLR::Module::StartupModule() {
 }
 
 void UnrealCLR::Module::ShutdownModule() {
+	#if UNREALCLR_PROFILER
+		UnrealCLR::Profiler::UnregisterCommands();
+	#endif
+
 	FWorldDelegates::OnPostWorldInitialization.Remove(OnWorldPostInitializationHandle);
 	FWorldDelegates::OnWorldCleanup.Remove(OnWorldCleanupHandle);
 
@@ -1388,11 +1515,16 @@ void UnrealCLR::Module::OnWorldPostInitialization(UWorld* World, const UWorld::I
 					RegisterTickFunction(OnDuringPhysicsTickFunction, TG_DuringPhysics, *currentActor);
 					RegisterTickFunction(OnPostPhysicsTickFunction, TG_PostPhysics, *currentActor);
 					RegisterTickFunction(OnPostUpdateTickFunction, TG_PostUpdateWork, *currentActor);
+					RegisterTickFunction(OnFrameEndTickFunction, TG_PostUpdateWork, *currentActor);
+
+					OnFrameEndTickFunction.AddPrerequisite(UnrealCLR::Engine::Manager, OnPostUpdateTickFunction);
 
 					UnrealCLR::WorldTickState = UnrealCLR::TickState::Registered;
 
+					UnrealCLR::Indexing::Initialize(UnrealCLR::Engine::World);
+
 					if (UnrealCLR::Shared::Events[OnWorldBegin])
-						UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldBegin]));
+						reinterpret_cast<UnrealCLR::WorldDelegate>(UnrealCLR::Shared::Events[OnWorldBegin])();
 
 					break;
 				}
@@ -1413,23 +1545,42 @@ void UnrealCLR::Module::OnWorldCleanup(UWorld* World, bool SessionEnded, bool Cl
 	if (World->IsGameWorld() && World == UnrealCLR::Engine::World && UnrealCLR::WorldTickState != UnrealCLR::TickState::Stopped) {
 		if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
 			if (UnrealCLR::Shared::Events[OnWorldEnd])
-				UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldEnd]));
+				reinterpret_cast<UnrealCLR::WorldDelegate>(UnrealCLR::Shared::Events[OnWorldEnd])();
 
 			OnPrePhysicsTickFunction.UnRegisterTickFunction();
 			OnDuringPhysicsTickFunction.UnRegisterTickFunction();
 			OnPostPhysicsTickFunction.UnRegisterTickFunction();
 			OnPostUpdateTickFunction.UnRegisterTickFunction();
+			OnFrameEndTickFunction.UnRegisterTickFunction();
+
+			UnrealCLR::Ticking::Reset();
+			UnrealCLR::Jobs::Reset();
 
 			UnrealCLR::ManagedCommand(UnrealCLR::Command(CommandType::UnloadAssemblies));
 			UnrealCLR::Status = UnrealCLR::StatusType::Idle;
 		}
 
+		UnrealCLR::Indexing::Reset(UnrealCLR::Engine::World);
+
 		UnrealCLR::Engine::World = nullptr;
 		UnrealCLR::Engine::Manager->RemoveFromRoot();
 		UnrealCLR::Engine::Manager = nullptr;
 		UnrealCLR::WorldTickState = UnrealCLR::TickState::Stopped;
 
 		FMemory::Memset(UnrealCLR::Shared::Events, 0, sizeof(UnrealCLR::Shared::Events));
+
+		UnrealCLR::Batching::Reset();
+		UnrealCLR::Coalescing::Reset();
+		UnrealCLR::Threading::Reset();
+		UnrealCLR::FixedTick::Reset();
+		UnrealCLR::Arena::Reset();
+		UnrealCLR::SpatialHash::Reset();
+		UnrealCLR::Handles::Reset();
+		UnrealCLR::Mirror::Reset();
+		UnrealCLR::Pooling::Reset();
+		UnrealCLR::Spawning::Reset();
+		UnrealCLR::AsyncQueries::Reset();
+		UnrealCLR::CollisionQueries::Reset();
 	}
 }
 
@@ -1443,6 +1594,10 @@ void UnrealCLR::Module::RegisterTickFunction(FTickFunction& TickFunction, ETicki
 	TickFunction.TickGroup = TickGroup;
 	TickFunction.RegisterTickFunction(UnrealCLR::Engine::World->PersistentLevel);
 	LevelActor->PrimaryActorTick.AddPrerequisite(UnrealCLR::Engine::Manager, TickFunction);
+
+	// Only the first function of the group runs managed code, functions registered after it are kept on the game thread
+	if (!UnrealCLR::Threading::TickFunctions[TickGroup])
+		UnrealCLR::Threading::TickFunctions[TickGroup] = &TickFunction;
 }
 
 void UnrealCLR::Module::HostError(const char_t* Message) {
@@ -1488,28 +1643,58 @@ void UnrealCLR::Module::Log(UnrealCLR::LogLevel Level, const char* Message) {
 }
 
 void UnrealCLR::PrePhysicsTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
+	UNREALCLR_PROFILER_TICK_GROUP(TickGroup);
+
+	UnrealCLR::Arena::BeginFrame();
+
 	if (UnrealCLR::WorldTickState != UnrealCLR::TickState::Started && UnrealCLR::Shared::Events[OnWorldPostBegin]) {
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldPostBegin]));
+		reinterpret_cast<UnrealCLR::WorldDelegate>(UnrealCLR::Shared::Events[OnWorldPostBegin])();
 		UnrealCLR::WorldTickState = UnrealCLR::TickState::Started;
 	}
 
+	UnrealCLR::AsyncQueries::Dispatch();
+	UnrealCLR::FixedTick::Advance(DeltaTime);
+
 	if (UnrealCLR::Shared::Events[OnWorldPrePhysicsTick])
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldPrePhysicsTick], DeltaTime));
+		reinterpret_cast<UnrealCLR::WorldTickDelegate>(UnrealCLR::Shared::Events[OnWorldPrePhysicsTick])(DeltaTime);
+
+	UnrealCLR::Batching::Dispatch();
 }
 
 void UnrealCLR::DuringPhysicsTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
+	UNREALCLR_PROFILER_TICK_GROUP(TickGroup);
+
 	if (UnrealCLR::Shared::Events[OnWorldDuringPhysicsTick])
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldDuringPhysicsTick], DeltaTime));
+		reinterpret_cast<UnrealCLR::WorldTickDelegate>(UnrealCLR::Shared::Events[OnWorldDuringPhysicsTick])(DeltaTime);
+
+	if (IsInGameThread())
+		UnrealCLR::Batching::Dispatch();
 }
 
 void UnrealCLR::PostPhysicsTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
+	UNREALCLR_PROFILER_TICK_GROUP(TickGroup);
+
 	if (UnrealCLR::Shared::Events[OnWorldPostPhysicsTick])
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldPostPhysicsTick], DeltaTime));
+		reinterpret_cast<UnrealCLR::WorldTickDelegate>(UnrealCLR::Shared::Events[OnWorldPostPhysicsTick])(DeltaTime);
+
+	if (IsInGameThread())
+		UnrealCLR::Batching::Dispatch();
 }
 
 void UnrealCLR::PostUpdateTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
+	UNREALCLR_PROFILER_TICK_GROUP(TickGroup);
+
 	if (UnrealCLR::Shared::Events[OnWorldPostUpdateTick])
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldPostUpdateTick], DeltaTime));
+		reinterpret_cast<UnrealCLR::WorldTickDelegate>(UnrealCLR::Shared::Events[OnWorldPostUpdateTick])(DeltaTime);
+}
+
+void UnrealCLR::FrameEndTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
+	UNREALCLR_PROFILER_TICK_GROUP(TickGroup);
+
+	// Never runs on worker threads, so the work that touches engine objects is never skipped
+	UnrealCLR::Batching::Dispatch();
+	UnrealCLR::Coalescing::Prune();
+	UnrealCLR::Mirror::Update();
 }
 
 FString UnrealCLR::PrePhysicsTickFunction::DiagnosticMessage() {
@@ -1528,32 +1713,1561 @@ FString UnrealCLR::PostUpdateTickFunction::DiagnosticMessage() {
 	return TEXT("PostUpdateTickFunction");
 }
 
-size_t UnrealCLR::Utility::Strcpy(char* Destination, const char* Source, size_t Length) {
-	char* destination = Destination;
-	const char* source = Source;
-	size_t length = Length;
+FString UnrealCLR::FrameEndTickFunction::DiagnosticMessage() {
+	return TEXT("FrameEndTickFunction");
+}
 
-	if (length != 0 && --length != 0) {
-		do {
-			if ((*destination++ = *source++) == 0)
-				break;
+void UnrealCLR::CustomTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
+	UNREALCLR_PROFILER_TICK_GROUP(TickGroup);
+
+	if (Callback && UnrealCLR::Status == UnrealCLR::StatusType::Running)
+		Callback(DeltaTime);
+}
+
+FString UnrealCLR::CustomTickFunction::DiagnosticMessage() {
+	return TEXT("CustomTickFunction");
+}
+
+bool UnrealCLR::Batching::IsEnabled() {
+	return UnrealCLR::Shared::Events[OnEventsBatch] != nullptr;
+}
+
+void UnrealCLR::Batching::Enqueue(int32 Event, UObject* FirstObject, UObject* SecondObject) {
+	Buffer& buffer = Buffers[Current];
+
+	buffer.Types.Add(Event);
+	buffer.FirstObjects.Add(FirstObject);
+	buffer.SecondObjects.Add(SecondObject);
+	buffer.HitIndices.Add(INDEX_NONE);
+}
+
+void UnrealCLR::Batching::Enqueue(int32 Event, UObject* FirstObject, UObject* SecondObject, const FVector& NormalImpulse, const FHitResult& Hit) {
+	Buffer& buffer = Buffers[Current];
+
+	buffer.Types.Add(Event);
+	buffer.FirstObjects.Add(FirstObject);
+	buffer.SecondObjects.Add(SecondObject);
+	buffer.HitIndices.Add(buffer.Hits.Num());
+	buffer.NormalImpulses.Emplace(NormalImpulse);
+	buffer.Hits.Emplace(Hit);
+	buffer.HitActors.Add(Hit.GetActor());
+}
+
+void UnrealCLR::Batching::Deliver(int32 Event, void* FirstObject, void* SecondObject, const UnrealCLRFramework::Vector3* NormalImpulse, const UnrealCLRFramework::Hit* Hit) {
+	void* callback = UnrealCLR::Shared::Events[Event];
+
+	if (!callback)
+		return;
+
+	switch (Event) {
+		case OnActorBeginOverlap:
+		case OnActorEndOverlap:
+			reinterpret_cast<UnrealCLRFramework::ActorOverlapDelegate>(callback)(static_cast<AActor*>(FirstObject), static_cast<AActor*>(SecondObject));
+			break;
+
+		case OnActorHit:
+			reinterpret_cast<UnrealCLRFramework::ActorHitDelegate>(callback)(static_cast<AActor*>(FirstObject), static_cast<AActor*>(SecondObject), NormalImpulse, Hit);
+			break;
+
+		case OnActorBeginCursorOver:
+		case OnActorEndCursorOver:
+			reinterpret_cast<UnrealCLRFramework::ActorCursorDelegate>(callback)(static_cast<AActor*>(FirstObject));
+			break;
+
+		case OnComponentBeginOverlap:
+		case OnComponentEndOverlap:
+			reinterpret_cast<UnrealCLRFramework::ComponentOverlapDelegate>(callback)(static_cast<UPrimitiveComponent*>(FirstObject), static_cast<UPrimitiveComponent*>(SecondObject));
+			break;
+
+		case OnComponentHit:
+			reinterpret_cast<UnrealCLRFramework::ComponentHitDelegate>(callback)(static_cast<UPrimitiveComponent*>(FirstObject), static_cast<UPrimitiveComponent*>(SecondObject), NormalImpulse, Hit);
+			break;
+
+		case OnComponentBeginCursorOver:
+		case OnComponentEndCursorOver:
+			reinterpret_cast<UnrealCLRFramework::ComponentCursorDelegate>(callback)(static_cast<UPrimitiveComponent*>(FirstObject));
+			break;
+
+		default:
+			break;
+	}
+}
+
+void UnrealCLR::Batching::Dispatch() {
+	if (Dispatching)
+		return;
+
+	Dispatching = true;
+
+	// Events raised by the callbacks are collected in the other buffer and dispatched with the next batch, or right away if the callbacks disabled batching
+
+	for (bool first = true; Buffers[Current].Types.Num() > 0 && (first || !IsEnabled()); first = false) {
+		Buffer& buffer = Buffers[Current];
+
+		Current ^= 1;
+
+		// Events of objects destroyed since they were raised are dropped
+		int32 count = 0;
+
+		buffer.FirstPointers.Reset();
+		buffer.SecondPointers.Reset();
+
+		for (int32 i = 0; i < buffer.Types.Num(); i++) {
+			if (buffer.FirstObjects[i].IsStale() || buffer.SecondObjects[i].IsStale())
+				continue;
+
+			const int32 hitIndex = buffer.HitIndices[i];
+
+			if (hitIndex != INDEX_NONE && buffer.HitActors[hitIndex].IsStale())
+				buffer.Hits[hitIndex].Actor = nullptr;
+
+			buffer.Types[count] = buffer.Types[i];
+			buffer.HitIndices[count] = hitIndex;
+			buffer.FirstPointers.Add(buffer.FirstObjects[i].Get());
+			buffer.SecondPointers.Add(buffer.SecondObjects[i].Get());
+
+			count++;
 		}
 
-		while (--length != 0);
+		if (UnrealCLR::Shared::Events[OnEventsBatch]) {
+			if (count > 0)
+				reinterpret_cast<UnrealCLRFramework::EventsBatchDelegate>(UnrealCLR::Shared::Events[OnEventsBatch])(buffer.Types.GetData(), buffer.FirstPointers.GetData(), buffer.SecondPointers.GetData(), buffer.HitIndices.GetData(), buffer.NormalImpulses.GetData(), buffer.Hits.GetData(), count);
+		} else {
+			for (int32 i = 0; i < count; i++) {
+				const int32 hitIndex = buffer.HitIndices[i];
+
+				if (hitIndex != INDEX_NONE)
+					Deliver(buffer.Types[i], buffer.FirstPointers[i], buffer.SecondPointers[i], &buffer.NormalImpulses[hitIndex], &buffer.Hits[hitIndex]);
+				else
+					Deliver(buffer.Types[i], buffer.FirstPointers[i], buffer.SecondPointers[i], nullptr, nullptr);
+			}
+		}
+
+		buffer.Types.Reset();
+		buffer.FirstObjects.Reset();
+		buffer.SecondObjects.Reset();
+		buffer.HitIndices.Reset();
+		buffer.NormalImpulses.Reset();
+		buffer.Hits.Reset();
+		buffer.HitActors.Reset();
+		buffer.FirstPointers.Reset();
+		buffer.SecondPointers.Reset();
 	}
 
-	if (length == 0) {
-		if (Length != 0)
-			*destination = '\0';
+	Dispatching = false;
+}
 
-		while (*source++);
+void UnrealCLR::Batching::Reset() {
+	for (Buffer& buffer : Buffers) {
+		buffer.Types.Empty();
+		buffer.FirstObjects.Empty();
+		buffer.SecondObjects.Empty();
+		buffer.HitIndices.Empty();
+		buffer.NormalImpulses.Empty();
+		buffer.Hits.Empty();
+		buffer.HitActors.Empty();
+		buffer.FirstPointers.Empty();
+		buffer.SecondPointers.Empty();
 	}
 
-	return (source - Source - 1);
+	Current = 0;
+	Dispatching = false;
 }
 
-size_t UnrealCLR::Utility::Strlen(const char* Source) {
-	return strlen(Source) + 1;
+void UnrealCLR::Coalescing::SetFilter(const UObject* Object, UnrealCLRFramework::HitFilter Type, float Value) {
+	if (Type == UnrealCLRFramework::HitFilter::None)
+		Filters.Remove(Object);
+	else
+		Filters.Add(Object, Filter { Type, Value });
+}
+
+bool UnrealCLR::Coalescing::ShouldDispatch(const UObject* Object, const UObject* OtherObject, const FVector& NormalImpulse) {
+	if (Filters.Num() == 0)
+		return true;
+
+	const Filter* filter = Filters.Find(Object);
+
+	if (!filter)
+		return true;
+
+	if (filter->Type == UnrealCLRFramework::HitFilter::Impulse)
+		return NormalImpulse.SizeSquared() > FMath::Square(filter->Value);
+
+	const uint64 frame = GFrameCounter;
+	const float time = UnrealCLR::Engine::World->GetTimeSeconds();
+	Contact* contact = Contacts.Find(TPair<const UObject*, const UObject*>(Object, OtherObject));
+
+	if (!contact) {
+		Contacts.Add(TPair<const UObject*, const UObject*>(Object, OtherObject), Contact { frame, time });
+
+		return true;
+	}
+
+	// A pair that was not in contact during the previous frame is treated as a new contact
+
+	const bool persistent = frame - contact->Frame <= 1;
+
+	contact->Frame = frame;
+
+	if (filter->Type == UnrealCLRFramework::HitFilter::FirstContact) {
+		if (persistent)
+			return false;
+
+		contact->Time = time;
+
+		return true;
+	}
+
+	if (filter->Type == UnrealCLRFramework::HitFilter::Rate) {
+		if (persistent && filter->Value > 0.0f && time - contact->Time < 1.0f / filter->Value)
+			return false;
+
+		contact->Time = time;
+
+		return true;
+	}
+
+	return true;
+}
+
+void UnrealCLR::Coalescing::Prune() {
+	// Filters of destroyed objects are never reset by the managed side
+	for (auto filter = Filters.CreateIterator(); filter; ++filter) {
+		if (filter.Key().IsStale())
+			filter.RemoveCurrent();
+	}
+
+	const uint64 frame = GFrameCounter;
+
+	for (auto contact = Contacts.CreateIterator(); contact; ++contact) {
+		if (frame - contact.Value().Frame > 1)
+			contact.RemoveCurrent();
+	}
+}
+
+void UnrealCLR::Coalescing::Reset() {
+	Filters.Empty();
+	Contacts.Empty();
+}
+
+bool UnrealCLR::Threading::SetRunOnAnyThread(ETickingGroup TickGroup, bool Value) {
+	if (TickGroup <= TG_PrePhysics || TickGroup >= TG_MAX || !TickFunctions[TickGroup])
+		return false;
+
+	TickFunctions[TickGroup]->bRunOnAnyThread = Value;
+
+	return true;
+}
+
+void UnrealCLR::Threading::Reset() {
+	for (FTickFunction*& tickFunction : TickFunctions) {
+		if (tickFunction)
+			tickFunction->bRunOnAnyThread = false;
+
+		tickFunction = nullptr;
+	}
+}
+
+void UnrealCLR::FixedTick::Set(float Step, int32 Substeps) {
+	StepTime = FMath::Max(Step, 0.0f);
+	MaxSubsteps = FMath::Max(Substeps, 1);
+	Accumulator = 0.0f;
+}
+
+void UnrealCLR::FixedTick::Advance(float DeltaTime) {
+	if (StepTime <= 0.0f || !UnrealCLR::Shared::Events[OnWorldFixedTick])
+		return;
+
+	Accumulator += DeltaTime;
+
+	const int32 substeps = FMath::Min(FMath::FloorToInt(Accumulator / StepTime), MaxSubsteps);
+
+	Accumulator -= substeps * StepTime;
+
+	// Time beyond the maximum amount of substeps is dropped to avoid falling behind further on each frame
+	if (Accumulator >= StepTime)
+		Accumulator = FMath::Fmod(Accumulator, StepTime);
+
+	if (substeps > 0)
+		reinterpret_cast<UnrealCLR::WorldFixedTickDelegate>(UnrealCLR::Shared::Events[OnWorldFixedTick])(StepTime, substeps, Accumulator / StepTime);
+}
+
+void UnrealCLR::FixedTick::Reset() {
+	StepTime = 0.0f;
+	MaxSubsteps = 0;
+	Accumulator = 0.0f;
+}
+
+int32 UnrealCLR::Ticking::Register(UnrealCLRFramework::TickDelegate Callback, ETickingGroup TickGroup, float TickInterval, bool TickEvenWhenPaused) {
+	if (!Callback || !UnrealCLR::Engine::World || TickGroup < TG_PrePhysics || TickGroup >= TG_NewlySpawned)
+		return INDEX_NONE;
+
+	int32 slot = TickFunctions.IndexOfByPredicate([](const TUniquePtr<CustomTickFunction>& TickFunction) {
+		return !TickFunction->Callback;
+	});
+
+	if (slot == INDEX_NONE) {
+		if (TickFunctions.Num() > slotMask)
+			return INDEX_NONE;
+
+		slot = TickFunctions.Add(MakeUnique<CustomTickFunction>());
+	}
+
+	CustomTickFunction& tickFunction = *TickFunctions[slot];
+
+	tickFunction.Callback = Callback;
+	tickFunction.bCanEverTick = true;
+	tickFunction.bTickEvenWhenPaused = TickEvenWhenPaused;
+	tickFunction.bStartWithTickEnabled = true;
+	tickFunction.bAllowTickOnDedicatedServer = true;
+	tickFunction.TickGroup = TickGroup;
+	tickFunction.TickInterval = TickInterval;
+	tickFunction.GetPrerequisites().Empty();
+	tickFunction.RegisterTickFunction(UnrealCLR::Engine::World->PersistentLevel);
+	tickFunction.SetTickFunctionEnable(true);
+
+	// The generation is encoded in the handle, so handles of unregistered functions never match a newer registration in the same slot
+	return (tickFunction.Generation << slotBits) | slot;
+}
+
+bool UnrealCLR::Ticking::Unregister(int32 Handle) {
+	CustomTickFunction* tickFunction = Find(Handle);
+
+	if (!tickFunction)
+		return false;
+
+	// Slots are reused instead of being freed since the function may be unregistered during its own execution
+	tickFunction->UnRegisterTickFunction();
+	tickFunction->Callback = nullptr;
+	tickFunction->Generation = FMath::Max((tickFunction->Generation + 1) & generationMask, 1);
+
+	return true;
+}
+
+UnrealCLR::CustomTickFunction* UnrealCLR::Ticking::Find(int32 Handle) {
+	const int32 slot = Handle & slotMask;
+
+	if (Handle < 0 || !TickFunctions.IsValidIndex(slot) || !TickFunctions[slot]->Callback || TickFunctions[slot]->Generation != Handle >> slotBits)
+		return nullptr;
+
+	return TickFunctions[slot].Get();
+}
+
+void UnrealCLR::Ticking::Reset() {
+	for (TUniquePtr<CustomTickFunction>& tickFunction : TickFunctions) {
+		tickFunction->UnRegisterTickFunction();
+	}
+
+	TickFunctions.Empty();
+}
+
+int32 UnrealCLR::Jobs::Add(const FGraphEventRef& Event) {
+	FScopeLock lock(&Lock);
+
+	for (auto job = Released.CreateIterator(); job; ++job) {
+		if (job->Value->IsComplete())
+			job.RemoveCurrent();
+	}
+
+	const int32 handle = NextHandle++;
+
+	Handles.Add(handle, Event);
+
+	return handle;
+}
+
+FGraphEventRef UnrealCLR::Jobs::Find(int32 Handle) {
+	FScopeLock lock(&Lock);
+
+	const FGraphEventRef* event = Handles.Find(Handle);
+
+	return event ? *event : FGraphEventRef();
+}
+
+bool UnrealCLR::Jobs::Gather(const int32* Prerequisites, int32 Count, FGraphEventArray& Events) {
+	FScopeLock lock(&Lock);
+
+	for (int32 i = 0; i < Count; i++) {
+		const int32 handle = Prerequisites[i];
+
+		if (handle < 0 || handle >= NextHandle)
+			return false;
+
+		const FGraphEventRef* event = Handles.Find(handle);
+
+		if (!event)
+			event = Released.Find(handle);
+
+		// Released jobs that are no longer tracked are complete
+		if (event)
+			Events.Add(*event);
+	}
+
+	return true;
+}
+
+void UnrealCLR::Jobs::Remove(int32 Handle) {
+	FScopeLock lock(&Lock);
+
+	FGraphEventRef event;
+
+	// Released jobs that are still running are tracked until completion to wait for them before unloading assemblies
+	if (Handles.RemoveAndCopyValue(Handle, event) && !event->IsComplete())
+		Released.Add(Handle, event);
+}
+
+void UnrealCLR::Jobs::Reset() {
+	FGraphEventArray events;
+
+	{
+		FScopeLock lock(&Lock);
+
+		Handles.GenerateValueArray(events);
+
+		for (const TPair<int32, FGraphEventRef>& job : Released) {
+			events.Add(job.Value);
+		}
+
+		Handles.Empty();
+		Released.Empty();
+		NextHandle = 0;
+	}
+
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(events);
+}
+
+void UnrealCLR::Lifetime::ActorDestroyed(AActor* Actor) {
+	if (!Actor)
+		return;
+
+	UnrealCLR::Indexing::Unlink(Actor);
+
+	if (UnrealCLR::Engine::Manager)
+		UnrealCLR::Engine::Manager->InvalidateComponents(Actor);
+
+	UnrealCLR::SpatialHash::Remove(Actor);
+	UnrealCLR::Handles::Invalidate(Actor);
+	UnrealCLR::Mirror::Remove(Actor);
+	UnrealCLR::Pooling::Remove(Actor);
+	UnrealCLR::Spawning::Remove(Actor);
+}
+
+void UnrealCLR::Indexing::Initialize(UWorld* World) {
+	for (TActorIterator<AActor> currentActor(World); currentActor; ++currentActor) {
+		Add(*currentActor);
+	}
+
+	OnActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateStatic(&Add));
+	OnLevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&OnLevelAdded);
+	OnLevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&OnLevelRemoved);
+
+	#if ENGINE_MAJOR_VERSION == 5
+		OnActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateStatic(&UnrealCLR::Lifetime::ActorDestroyed));
+	#endif
+}
+
+void UnrealCLR::Indexing::Add(AActor* Actor) {
+	if (!Actor)
+		return;
+
+	Names.AddUnique(Actor->GetFName(), Actor);
+	IDs.Add(Actor->GetUniqueID(), Actor);
+
+	for (const FName& tag : Actor->Tags) {
+		Tags.AddUnique(tag, Actor);
+	}
+
+	#if ENGINE_MAJOR_VERSION < 5
+		// The world has no handler for destroyed actors prior to UE5, so each indexed actor is tracked individually
+		if (UnrealCLR::Engine::Manager)
+			Actor->OnDestroyed.AddUniqueDynamic(UnrealCLR::Engine::Manager, &UUnrealCLRManager::ActorDestroyed);
+	#endif
+}
+
+void UnrealCLR::Indexing::Unlink(AActor* Actor) {
+	const TWeakObjectPtr<AActor> actor(Actor);
+	const TWeakObjectPtr<AActor>* entry = IDs.Find(Actor->GetUniqueID());
+
+	if (entry && *entry == actor)
+		IDs.Remove(Actor->GetUniqueID());
+
+	Names.RemoveSingle(Actor->GetFName(), actor);
+
+	for (const FName& tag : Actor->Tags) {
+		Tags.RemoveSingle(tag, actor);
+	}
+}
+
+void UnrealCLR::Indexing::AddTag(AActor* Actor, FName Tag) {
+	Tags.AddUnique(Tag, Actor);
+}
+
+void UnrealCLR::Indexing::RemoveTag(AActor* Actor, FName Tag) {
+	Tags.RemoveSingle(Tag, Actor);
+}
+
+bool UnrealCLR::Indexing::Rename(AActor* Actor, const TCHAR* Name) {
+	const FName previousName = Actor->GetFName();
+
+	if (!Actor->Rename(Name))
+		return false;
+
+	// Actors are indexed on spawn under the generated name, so the entry is moved to the new name
+	if (Names.RemoveSingle(previousName, Actor) > 0)
+		Names.AddUnique(Actor->GetFName(), Actor);
+
+	return true;
+}
+
+void UnrealCLR::Indexing::OnLevelAdded(ULevel* Level, UWorld* World) {
+	if (World != UnrealCLR::Engine::World)
+		return;
+
+	for (AActor* actor : Level->Actors) {
+		Add(actor);
+	}
+}
+
+void UnrealCLR::Indexing::OnLevelRemoved(ULevel* Level, UWorld* World) {
+	if (World != UnrealCLR::Engine::World || !Level)
+		return;
+
+	for (AActor* actor : Level->Actors) {
+		UnrealCLR::Lifetime::ActorDestroyed(actor);
+	}
+}
+
+// Entries are validated on lookup since actors may be destroyed, renamed, or retagged without notifying the index
+
+AActor* UnrealCLR::Indexing::FindByName(FName Name, UClass* Type) {
+	for (auto entry = Names.CreateKeyIterator(Name); entry; ++entry) {
+		AActor* actor = entry.Value().Get();
+
+		if (!actor || actor->GetFName() != Name) {
+			entry.RemoveCurrent();
+
+			continue;
+		}
+
+		if (actor->IsA(Type))
+			return actor;
+	}
+
+	return nullptr;
+}
+
+bool UnrealCLR::Indexing::IndexTag(FName Tag) {
+	const int32 entries = Tags.Num();
+
+	for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World); currentActor; ++currentActor) {
+		// Pooled actors are unlinked while parked and indexed again once acquired
+		if (currentActor->ActorHasTag(Tag) && !UnrealCLR::Pooling::Parked.Contains(*currentActor))
+			Tags.AddUnique(Tag, *currentActor);
+	}
+
+	return Tags.Num() != entries;
+}
+
+AActor* UnrealCLR::Indexing::FindByTag(FName Tag, UClass* Type) {
+	// Tags added outside of the framework are not indexed, so the world is walked once on a miss to index them
+	for (int32 attempt = 0; attempt < 2; attempt++) {
+		for (auto entry = Tags.CreateKeyIterator(Tag); entry; ++entry) {
+			AActor* actor = entry.Value().Get();
+
+			if (!actor || !actor->ActorHasTag(Tag)) {
+				entry.RemoveCurrent();
+
+				continue;
+			}
+
+			if (actor->IsA(Type))
+				return actor;
+		}
+
+		if (attempt > 0 || !IndexTag(Tag))
+			break;
+	}
+
+	return nullptr;
+}
+
+void UnrealCLR::Indexing::FindAllByTag(FName Tag, UClass* Type, TArray<AActor*>& Actors) {
+	const int32 elements = Actors.Num();
+
+	// Tags added outside of the framework are not indexed, so the world is walked once if no indexed actor matches
+	for (int32 attempt = 0; attempt < 2; attempt++) {
+		for (auto entry = Tags.CreateKeyIterator(Tag); entry; ++entry) {
+			AActor* actor = entry.Value().Get();
+
+			if (!actor || !actor->ActorHasTag(Tag)) {
+				entry.RemoveCurrent();
+
+				continue;
+			}
+
+			if (actor->IsA(Type))
+				Actors.Add(actor);
+		}
+
+		if (Actors.Num() != elements || attempt > 0 || !IndexTag(Tag))
+			break;
+	}
+}
+
+AActor* UnrealCLR::Indexing::FindByID(uint32 ID, UClass* Type) {
+	const TWeakObjectPtr<AActor>* entry = IDs.Find(ID);
+
+	if (!entry)
+		return nullptr;
+
+	AActor* actor = entry->Get();
+
+	if (!actor || actor->GetUniqueID() != ID) {
+		IDs.Remove(ID);
+
+		return nullptr;
+	}
+
+	return actor->IsA(Type) ? actor : nullptr;
+}
+
+void UnrealCLR::Indexing::Reset(UWorld* World) {
+	if (World) {
+		World->RemoveOnActorSpawnedHandler(OnActorSpawnedHandle);
+
+		#if ENGINE_MAJOR_VERSION == 5
+			// The name of the function is misspelled in the engine
+			World->RemoveOnActorDestroyededHandler(OnActorDestroyedHandle);
+		#endif
+	}
+
+	FWorldDelegates::LevelAddedToWorld.Remove(OnLevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(OnLevelRemovedHandle);
+
+	Names.Empty();
+	Tags.Empty();
+	IDs.Empty();
+}
+
+void* UnrealCLR::Arena::Allocate(int32 Size, int32 Alignment) {
+	BeginFrame();
+
+	if (Chunks.Num() > 0) {
+		TArray<uint8>& chunk = Chunks.Last();
+		uint8* address = Align(chunk.GetData() + Offset, Alignment);
+		const int32 end = static_cast<int32>(address - chunk.GetData()) + Size;
+
+		if (end <= chunk.Num()) {
+			Used += end - Offset;
+			Offset = end;
+
+			return address;
+		}
+	}
+
+	// Chunks are never reallocated, so previously returned memory stays valid until the next frame
+	TArray<uint8>& chunk = Chunks.AddDefaulted_GetRef();
+
+	chunk.SetNumUninitialized(FMath::Max(chunkSize, Size + Alignment));
+
+	uint8* address = Align(chunk.GetData(), Alignment);
+
+	Offset = static_cast<int32>(address - chunk.GetData()) + Size;
+	Used += Offset;
+
+	return address;
+}
+
+void UnrealCLR::Arena::BeginFrame() {
+	if (Frame == GFrameCounter)
+		return;
+
+	for (const Destructor& destructor : Destructors) {
+		destructor.Function(destructor.Objects, destructor.Count);
+	}
+
+	Destructors.Reset();
+
+	// Coalesce the chunks into a single one sized after the previous frame, or shrink it when the usage drops
+	const int32 capacity = FMath::Max(chunkSize, static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(Used))));
+
+	if (Chunks.Num() > 1 || (Chunks.Num() == 1 && Chunks[0].Num() > capacity * 4)) {
+		Chunks.Empty(1);
+		Chunks.AddDefaulted_GetRef().SetNumUninitialized(capacity);
+	}
+
+	Offset = 0;
+	Used = 0;
+	Frame = GFrameCounter;
+}
+
+void UnrealCLR::Arena::Reset() {
+	for (const Destructor& destructor : Destructors) {
+		destructor.Function(destructor.Objects, destructor.Count);
+	}
+
+	Destructors.Empty();
+	Chunks.Empty();
+	Offset = 0;
+	Used = 0;
+	Frame = 0;
+}
+
+uint32& UnrealCLR::Handles::GetGeneration(int32 Slot) {
+	return Chunks[Slot >> chunkShift][Slot & (chunkSize - 1)];
+}
+
+uint64 UnrealCLR::Handles::Acquire(AActor* Actor) {
+	if (!Actor || Actor->IsPendingKillPending())
+		return 0;
+
+	const int32* existing = Slots.Find(Actor);
+	int32 slot = INDEX_NONE;
+
+	if (existing) {
+		slot = *existing;
+	} else {
+		if (FreeSlots.Num() > 0) {
+			slot = FreeSlots.Pop();
+		} else {
+			slot = SharedTable.Length;
+
+			if (slot >= chunkSize * maxChunks)
+				return 0;
+
+			uint32*& chunk = Chunks[slot >> chunkShift];
+
+			if (!chunk)
+				chunk = static_cast<uint32*>(FMemory::MallocZeroed(chunkSize * sizeof(uint32)));
+
+			chunk[slot & (chunkSize - 1)] = 1;
+
+			// The generation is published before the length since readers validate the slot against the length first
+			FPlatformMisc::MemoryBarrier();
+
+			SharedTable.Length = slot + 1;
+		}
+
+		Slots.Add(Actor, slot);
+
+		Actor->OnDestroyed.AddUniqueDynamic(UnrealCLR::Engine::Manager, &UUnrealCLRManager::ActorDestroyed);
+	}
+
+	return (static_cast<uint64>(GetGeneration(slot)) << 32) | static_cast<uint32>(slot);
+}
+
+void UnrealCLR::Handles::Invalidate(const AActor* Actor) {
+	int32 slot = INDEX_NONE;
+
+	if (!Slots.RemoveAndCopyValue(Actor, slot))
+		return;
+
+	uint32& generation = GetGeneration(slot);
+
+	// Generation zero is reserved for invalid handles
+	if (++generation == 0)
+		generation = 1;
+
+	FreeSlots.Add(slot);
+}
+
+void UnrealCLR::Handles::Reset() {
+	TArray<const AActor*> actors;
+
+	Slots.GenerateKeyArray(actors);
+
+	for (const AActor* actor : actors) {
+		Invalidate(actor);
+	}
+}
+
+int32 UnrealCLR::Mirror::Add(AActor* Actor) {
+	if (!Actor)
+		return INDEX_NONE;
+
+	const int32* existing = Slots.Find(Actor);
+
+	if (existing)
+		return *existing;
+
+	int32 slot = INDEX_NONE;
+
+	if (FreeSlots.Num() > 0) {
+		slot = FreeSlots.Pop();
+		Actors[slot] = Actor;
+	} else {
+		slot = Actors.Add(Actor);
+
+		if (slot >= Buffers[0].Num())
+			Grow(FMath::Max(minCapacity, Buffers[0].Num() * 2));
+
+		// The length is published after the buffers since readers load it first
+		FPlatformMisc::MemoryBarrier();
+
+		SharedTable.Length = Actors.Num();
+	}
+
+	Slots.Add(Actor, slot);
+
+	return slot;
+}
+
+bool UnrealCLR::Mirror::Remove(const AActor* Actor) {
+	int32 slot = INDEX_NONE;
+
+	if (!Slots.RemoveAndCopyValue(Actor, slot))
+		return false;
+
+	// The published state stays intact until the next update, the slot is reused only after that
+	Actors[slot].Reset();
+	RemovedSlots.Add(slot);
+
+	return true;
+}
+
+void UnrealCLR::Mirror::Grow(int32 Capacity) {
+	for (int32 i = 0; i < 2; i++) {
+		TArray<UnrealCLRFramework::ActorState> buffer;
+
+		buffer.SetNumZeroed(Capacity);
+
+		FMemory::Memcpy(buffer.GetData(), Buffers[i].GetData(), Buffers[i].Num() * sizeof(UnrealCLRFramework::ActorState));
+
+		// Previous buffers are kept until the world is cleaned up since spans over them may still be in use
+		if (Buffers[i].Num() > 0)
+			Retired.Add(MoveTemp(Buffers[i]));
+
+		Buffers[i] = MoveTemp(buffer);
+		SharedTable.Buffers[i] = Buffers[i].GetData();
+	}
+}
+
+void UnrealCLR::Mirror::Update() {
+	const int32 next = SharedTable.Current ^ 1;
+	UnrealCLRFramework::ActorState* states = Buffers[next].GetData();
+
+	for (int32 i = 0; i < Actors.Num(); i++) {
+		AActor* actor = Actors[i].Get();
+		UnrealCLRFramework::ActorState& state = states[i];
+
+		if (actor && !actor->IsPendingKillPending()) {
+			state.Location = actor->GetActorLocation();
+			state.Rotation = actor->GetActorQuat();
+			state.Velocity = actor->GetVelocity();
+			state.Hidden = actor->IsHidden();
+			state.Valid = true;
+		} else {
+			FMemory::Memzero(&state, sizeof(UnrealCLRFramework::ActorState));
+		}
+	}
+
+	FPlatformMisc::MemoryBarrier();
+
+	SharedTable.Current = next;
+
+	FreeSlots.Append(RemovedSlots);
+	RemovedSlots.Reset();
+}
+
+void UnrealCLR::Mirror::Reset() {
+	Buffers[0].Empty();
+	Buffers[1].Empty();
+	Retired.Empty();
+	Actors.Empty();
+	FreeSlots.Empty();
+	RemovedSlots.Empty();
+	Slots.Empty();
+
+	SharedTable = { { nullptr, nullptr }, 0, 0 };
+}
+
+AActor* UnrealCLR::Pooling::Acquire(UClass* Type, const FTransform& Transform) {
+	TArray<TWeakObjectPtr<AActor>>* pool = Pools.Find(Type);
+
+	while (pool && pool->Num() > 0) {
+		AActor* actor = pool->Pop().Get();
+		State state;
+
+		if (!actor || !Parked.RemoveAndCopyValue(actor, state))
+			continue;
+
+		DEC_DWORD_STAT(STAT_UnrealCLRPooledActors);
+
+		if (actor->IsPendingKillPending())
+			continue;
+
+		INC_DWORD_STAT(STAT_UnrealCLRPoolHits);
+
+		actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+		actor->SetActorHiddenInGame(state.Hidden);
+		actor->SetActorEnableCollision(state.CollisionEnabled);
+		actor->SetActorTickEnabled(state.TickEnabled);
+
+		for (const TWeakObjectPtr<UActorComponent>& component : state.TickingComponents) {
+			if (component.IsValid())
+				component->SetComponentTickEnabled(true);
+		}
+
+		UnrealCLR::Indexing::Add(actor);
+
+		if (state.Hashed)
+			UnrealCLR::SpatialHash::Add(actor);
+
+		if (state.Mirrored)
+			UnrealCLR::Mirror::Add(actor);
+
+		return actor;
+	}
+
+	INC_DWORD_STAT(STAT_UnrealCLRPoolMisses);
+
+	return UnrealCLR::Engine::World->SpawnActor(Type, &Transform);
+}
+
+bool UnrealCLR::Pooling::Release(AActor* Actor) {
+	if (!Actor || Actor->IsPendingKillPending() || Parked.Contains(Actor))
+		return false;
+
+	INC_DWORD_STAT(STAT_UnrealCLRPoolReleases);
+
+	Park(Actor);
+
+	return true;
+}
+
+void UnrealCLR::Pooling::Prewarm(UClass* Type, int32 Count) {
+	for (int32 i = 0; i < Count; i++) {
+		AActor* actor = UnrealCLR::Engine::World->SpawnActor(Type, &FTransform::Identity);
+
+		if (actor)
+			Park(actor);
+	}
+}
+
+void UnrealCLR::Pooling::Park(AActor* Actor) {
+	State state;
+
+	state.Hidden = Actor->IsHidden();
+	state.CollisionEnabled = Actor->GetActorEnableCollision();
+	state.TickEnabled = Actor->IsActorTickEnabled();
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	for (UActorComponent* component : Actor->GetComponents()) {
+		if (component && component->IsComponentTickEnabled()) {
+			state.TickingComponents.Add(component);
+			component->SetComponentTickEnabled(false);
+		}
+	}
+
+	// Parked actors are not found by lookups and queries until they are acquired again
+	UnrealCLR::Indexing::Unlink(Actor);
+
+	state.Hashed = UnrealCLR::SpatialHash::Remove(Actor);
+	state.Mirrored = UnrealCLR::Mirror::Remove(Actor);
+
+	Pools.FindOrAdd(Actor->GetClass()).Add(Actor);
+	Parked.Add(Actor, MoveTemp(state));
+
+	INC_DWORD_STAT(STAT_UnrealCLRPooledActors);
+}
+
+void UnrealCLR::Pooling::Remove(const AActor* Actor) {
+	if (Parked.Remove(Actor) > 0)
+		DEC_DWORD_STAT(STAT_UnrealCLRPooledActors);
+}
+
+void UnrealCLR::Pooling::Reset() {
+	DEC_DWORD_STAT_BY(STAT_UnrealCLRPooledActors, Parked.Num());
+
+	Pools.Empty();
+	Parked.Empty();
+}
+
+AActor* UnrealCLR::Spawning::Begin(UClass* Type, const FTransform& Transform) {
+	AActor* actor = UnrealCLR::Engine::World->SpawnActorDeferred<AActor>(Type, Transform);
+
+	if (actor)
+		Deferred.Add(actor, Transform);
+
+	return actor;
+}
+
+bool UnrealCLR::Spawning::Finish(AActor* Actor) {
+	FTransform transform;
+
+	if (!Deferred.RemoveAndCopyValue(Actor, transform) || Actor->IsPendingKillPending())
+		return false;
+
+	Actor->FinishSpawning(transform);
+
+	return true;
+}
+
+void UnrealCLR::Spawning::Remove(const AActor* Actor) {
+	Deferred.Remove(Actor);
+}
+
+void UnrealCLR::Spawning::Reset() {
+	Deferred.Empty();
+}
+
+int32 UnrealCLR::CollisionQueries::Create(ECollisionChannel Channel, FName Profile, bool TraceComplex) {
+	Descriptor descriptor;
+
+	descriptor.Params.bTraceComplex = TraceComplex;
+	descriptor.Profile = Profile;
+	descriptor.Channel = Channel;
+
+	const int32 slot = Descriptors.Add(MoveTemp(descriptor));
+
+	if (slot > slotMask) {
+		Descriptors.RemoveAt(slot);
+
+		return INDEX_NONE;
+	}
+
+	while (Generations.Num() <= slot) {
+		Generations.Add(1);
+	}
+
+	// The generation is encoded in the handle since slots of destroyed descriptors are reused
+	return (Generations[slot] << slotBits) | slot;
+}
+
+bool UnrealCLR::CollisionQueries::Destroy(int32 Handle) {
+	if (!Find(Handle))
+		return false;
+
+	const int32 slot = Handle & slotMask;
+
+	Descriptors.RemoveAt(slot);
+	Invalidate(slot);
+
+	return true;
+}
+
+UnrealCLR::CollisionQueries::Descriptor* UnrealCLR::CollisionQueries::Find(int32 Handle) {
+	const int32 slot = Handle & slotMask;
+
+	if (Handle < 0 || !Descriptors.IsValidIndex(slot) || Generations[slot] != Handle >> slotBits)
+		return nullptr;
+
+	return &Descriptors[slot];
+}
+
+void UnrealCLR::CollisionQueries::Invalidate(int32 Slot) {
+	Generations[Slot] = FMath::Max((Generations[Slot] + 1) & generationMask, 1);
+}
+
+void UnrealCLR::CollisionQueries::Reset() {
+	// Generations are kept to reject handles of the previous world
+	for (auto descriptor = Descriptors.CreateConstIterator(); descriptor; ++descriptor) {
+		Invalidate(descriptor.GetIndex());
+	}
+
+	Descriptors.Empty();
+}
+
+uint32 UnrealCLR::AsyncQueries::Acquire() {
+	if (!TraceDelegate.IsBound()) {
+		TraceDelegate.BindStatic(&TraceCompleted);
+		OverlapDelegate.BindStatic(&OverlapCompleted);
+	}
+
+	// Zero is reserved as an invalid ticket
+
+	if (++NextTicket == 0)
+		++NextTicket;
+
+	return NextTicket;
+}
+
+void UnrealCLR::AsyncQueries::TraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum) {
+	if (Datum.OutHits.Num() == 0) {
+		Results.Emplace(Datum.UserData, FHitResult(Datum.Start, Datum.End));
+
+		return;
+	}
+
+	for (const FHitResult& hit : Datum.OutHits) {
+		Results.Emplace(Datum.UserData, hit);
+	}
+}
+
+void UnrealCLR::AsyncQueries::OverlapCompleted(const FTraceHandle& Handle, FOverlapDatum& Datum) {
+	if (Datum.OutOverlaps.Num() == 0) {
+		Results.Emplace(Datum.UserData, FHitResult(Datum.Pos, Datum.Pos));
+
+		return;
+	}
+
+	for (const FOverlapResult& overlap : Datum.OutOverlaps) {
+		FHitResult hit(overlap.GetActor(), overlap.GetComponent(), Datum.Pos, FVector::ZeroVector);
+
+		hit.TraceStart = Datum.Pos;
+		hit.TraceEnd = Datum.Pos;
+		hit.bBlockingHit = overlap.bBlockingHit;
+
+		Results.Emplace(Datum.UserData, hit);
+	}
+}
+
+void UnrealCLR::AsyncQueries::Dispatch() {
+	if (Results.Num() == 0)
+		return;
+
+	if (UnrealCLR::Shared::Events[OnAsyncQueries])
+		reinterpret_cast<UnrealCLRFramework::AsyncQueriesDelegate>(UnrealCLR::Shared::Events[OnAsyncQueries])(Results.GetData(), Results.Num());
+
+	Results.Reset();
+}
+
+void UnrealCLR::AsyncQueries::Reset() {
+	Results.Empty();
+
+	NextTicket = 0;
+}
+
+FIntVector UnrealCLR::SpatialHash::GetCell(const FVector& Location) {
+	return FIntVector(FMath::FloorToInt(static_cast<float>(Location.X) / CellSize), FMath::FloorToInt(static_cast<float>(Location.Y) / CellSize), FMath::FloorToInt(static_cast<float>(Location.Z) / CellSize));
+}
+
+void UnrealCLR::SpatialHash::Insert(int32 Index) {
+	Entry& entry = Entries[Index];
+
+	entry.Cell = GetCell(entry.Location);
+
+	Cells.FindOrAdd(entry.Cell).Add(Index);
+}
+
+void UnrealCLR::SpatialHash::Erase(int32 Index) {
+	const FIntVector& cell = Entries[Index].Cell;
+	TArray<int32>* indices = Cells.Find(cell);
+
+	if (indices) {
+		indices->RemoveSingleSwap(Index);
+
+		if (indices->Num() == 0)
+			Cells.Remove(cell);
+	}
+}
+
+void UnrealCLR::SpatialHash::SetCellSize(float Size) {
+	CellSize = FMath::Max(Size, 1.0f);
+
+	Cells.Reset();
+
+	for (const TPair<const AActor*, int32>& index : Indices) {
+		Insert(index.Value);
+	}
+}
+
+bool UnrealCLR::SpatialHash::Add(AActor* Actor) {
+	if (!Actor)
+		return false;
+
+	const int32* existing = Indices.Find(Actor);
+
+	if (existing) {
+		if (Entries[*existing].Actor.Get() == Actor)
+			return false;
+
+		// The address was reused by a new actor after the previous one was collected
+		Remove(Actor);
+	}
+
+	USceneComponent* component = Actor->GetRootComponent();
+
+	if (!component)
+		return false;
+
+	const int32 index = FreeEntries.Num() > 0 ? FreeEntries.Pop() : Entries.AddDefaulted();
+	Entry& entry = Entries[index];
+
+	entry.Actor = Actor;
+	entry.Component = component;
+	entry.Location = component->GetComponentLocation();
+	entry.TransformUpdatedHandle = component->TransformUpdated.AddStatic(&Update, index);
+
+	Indices.Add(Actor, index);
+	Insert(index);
+
+	return true;
+}
+
+bool UnrealCLR::SpatialHash::Remove(AActor* Actor) {
+	int32 index = INDEX_NONE;
+
+	if (!Indices.RemoveAndCopyValue(Actor, index))
+		return false;
+
+	Entry& entry = Entries[index];
+	USceneComponent* component = entry.Component.Get();
+
+	if (component)
+		component->TransformUpdated.Remove(entry.TransformUpdatedHandle);
+
+	Erase(index);
+
+	entry = Entry();
+	FreeEntries.Add(index);
+
+	return true;
+}
+
+void UnrealCLR::SpatialHash::Update(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 Index) {
+	Entry& entry = Entries[Index];
+
+	entry.Location = Component->GetComponentLocation();
+
+	if (GetCell(entry.Location) != entry.Cell) {
+		Erase(Index);
+		Insert(Index);
+	}
+}
+
+int32 UnrealCLR::SpatialHash::QueryRadius(const FVector& Center, float Radius, AActor** Actors, int32 Length) {
+	const float radiusSquared = Radius * Radius;
+	int32 elements = 0;
+
+	ForEachInBox(Center - FVector(Radius), Center + FVector(Radius), [&](const Entry& Current, AActor* Actor) {
+		if (FVector::DistSquared(Current.Location, Center) <= radiusSquared) {
+			if (elements < Length)
+				Actors[elements] = Actor;
+
+			elements++;
+		}
+	});
+
+	return elements;
+}
+
+int32 UnrealCLR::SpatialHash::QueryBox(const FVector& Min, const FVector& Max, AActor** Actors, int32 Length) {
+	const FBox box(Min, Max);
+	int32 elements = 0;
+
+	ForEachInBox(Min, Max, [&](const Entry& Current, AActor* Actor) {
+		if (box.IsInsideOrOn(Current.Location)) {
+			if (elements < Length)
+				Actors[elements] = Actor;
+
+			elements++;
+		}
+	});
+
+	return elements;
+}
+
+int32 UnrealCLR::SpatialHash::QueryKNearest(const FVector& Center, float MaxDistance, AActor** Actors, int32 Length) {
+	if (Length <= 0)
+		return 0;
+
+	// Most queries visit a few cells, so candidates are kept on the stack unless there are more of them
+	TArray<TPair<float, AActor*>, TInlineAllocator<64>> candidates;
+	const FIntVector center = GetCell(Center);
+	const float maxDistanceSquared = MaxDistance > 0.0f ? MaxDistance * MaxDistance : MAX_flt;
+	int32 elements = 0;
+
+	auto visitor = [&](const Entry& Current, AActor* Actor) {
+		candidates.Emplace(static_cast<float>(FVector::DistSquared(Current.Location, Center)), Actor);
+	};
+
+	auto comparer = [](const TPair<float, AActor*>& First, const TPair<float, AActor*>& Second) {
+		return First.Key < Second.Key;
+	};
+
+	// Visit cells in rings of growing size around the center until the nearest actors are known
+	for (int32 ring = 0; ; ring++) {
+		const int64 side = 2 * ring + 1;
+
+		if (side * side * side > Cells.Num()) {
+			candidates.Reset();
+
+			for (const TPair<FIntVector, TArray<int32>>& cell : Cells) {
+				ForEachInCell(cell.Key, visitor);
+			}
+
+			break;
+		}
+
+		for (int32 x = -ring; x <= ring; x++) {
+			for (int32 y = -ring; y <= ring; y++) {
+				if (FMath::Abs(x) == ring || FMath::Abs(y) == ring) {
+					for (int32 z = -ring; z <= ring; z++) {
+						ForEachInCell(center + FIntVector(x, y, z), visitor);
+					}
+				} else {
+					ForEachInCell(center + FIntVector(x, y, -ring), visitor);
+					ForEachInCell(center + FIntVector(x, y, ring), visitor);
+				}
+			}
+		}
+
+		// Actors in cells that are not visited yet are farther than this distance
+		const float reach = ring * CellSize;
+
+		if (MaxDistance > 0.0f && reach >= MaxDistance)
+			break;
+
+		if (candidates.Num() >= Length) {
+			candidates.Sort(comparer);
+
+			if (candidates[Length - 1].Key <= reach * reach)
+				break;
+		}
+	}
+
+	candidates.Sort(comparer);
+
+	for (const TPair<float, AActor*>& candidate : candidates) {
+		if (elements == Length || candidate.Key > maxDistanceSquared)
+			break;
+
+		Actors[elements++] = candidate.Value;
+	}
+
+	return elements;
+}
+
+void UnrealCLR::SpatialHash::Reset() {
+	for (const Entry& entry : Entries) {
+		USceneComponent* component = entry.Component.Get();
+
+		if (component)
+			component->TransformUpdated.Remove(entry.TransformUpdatedHandle);
+	}
+
+	Entries.Empty();
+	FreeEntries.Empty();
+	Indices.Empty();
+	Cells.Empty();
+	CellSize = 1000.0f;
+}
+
+#if UNREALCLR_PROFILER
+	void UnrealCLR::Profiler::Start(const TArray<FString>& Arguments) {
+		for (Entry& entry : Entries) {
+			FMemory::Memzero(entry.Calls);
+			FMemory::Memzero(entry.Cycles);
+		}
+
+		FirstFrame = GFrameCounter;
+		LastFrame = GFrameCounter;
+		Enabled = true;
+
+		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Interop profiling started at frame %llu"), ANSI_TO_TCHAR(__FUNCTION__), FirstFrame);
+	}
+
+	void UnrealCLR::Profiler::Stop(const TArray<FString>& Arguments) {
+		if (!Enabled)
+			return;
+
+		LastFrame = GFrameCounter;
+		Enabled = false;
+
+		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Interop profiling stopped at frame %llu"), ANSI_TO_TCHAR(__FUNCTION__), LastFrame);
+	}
+
+	void UnrealCLR::Profiler::Dump(const TArray<FString>& Arguments) {
+		struct Record {
+			const TCHAR* Name;
+			ETickingGroup TickGroup;
+			int64 Calls;
+			double Milliseconds;
+		};
+
+		TArray<Record> records;
+
+		for (const Entry& entry : Entries) {
+			for (int32 tickGroup = 0; tickGroup <= TG_MAX; tickGroup++) {
+				if (entry.Calls[tickGroup] > 0)
+					records.Add(Record { entry.Name, static_cast<ETickingGroup>(tickGroup), entry.Calls[tickGroup], FPlatformTime::ToMilliseconds64(entry.Cycles[tickGroup]) });
+			}
+		}
+
+		records.Sort([](const Record& Left, const Record& Right) {
+			return Left.Milliseconds > Right.Milliseconds;
+		});
+
+		const uint64 lastFrame = Enabled ? GFrameCounter : LastFrame;
+		const int32 top = Arguments.Num() > 0 ? FCString::Atoi(*Arguments[0]) : 20;
+		const UEnum* tickGroups = StaticEnum<ETickingGroup>();
+		FString csv(TEXT("Function,TickGroup,Calls,InclusiveMilliseconds,AverageNanoseconds,FirstFrame,LastFrame\n"));
+
+		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Interop calls in frames %llu-%llu"), ANSI_TO_TCHAR(__FUNCTION__), FirstFrame, lastFrame);
+
+		for (int32 i = 0; i < records.Num(); i++) {
+			const Record& record = records[i];
+			const FString tickGroup = record.TickGroup < TG_MAX ? tickGroups->GetNameStringByValue(record.TickGroup) : TEXT("None");
+			const double average = record.Milliseconds * 1000000.0 / record.Calls;
+
+			if (i < top)
+				UE_LOG(LogUnrealCLR, Display, TEXT("%s: %s [%s] %lld calls, %.3f ms, %.1f ns/call"), ANSI_TO_TCHAR(__FUNCTION__), record.Name, *tickGroup, record.Calls, record.Milliseconds, average);
+
+			csv += FString::Printf(TEXT("%s,%s,%lld,%.6f,%.1f,%llu,%llu\n"), record.Name, *tickGroup, record.Calls, record.Milliseconds, average, FirstFrame, lastFrame);
+		}
+
+		const FString path = FPaths::Combine(FPaths::ProfilingDir(), TEXT("UnrealCLR"), FString::Printf(TEXT("Interop-%llu-%llu.csv"), FirstFrame, lastFrame));
+
+		if (FFileHelper::SaveStringToFile(csv, *path))
+			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Interop profile saved to %s"), ANSI_TO_TCHAR(__FUNCTION__), *path);
+	}
+
+	void UnrealCLR::Profiler::RegisterCommands() {
+		IConsoleManager::Get().RegisterConsoleCommand(TEXT("UnrealCLR.Profiler.Start"), TEXT("Resets and starts recording of interop calls"), FConsoleCommandWithArgsDelegate::CreateStatic(&UnrealCLR::Profiler::Start));
+		IConsoleManager::Get().RegisterConsoleCommand(TEXT("UnrealCLR.Profiler.Stop"), TEXT("Stops recording of interop calls"), FConsoleCommandWithArgsDelegate::CreateStatic(&UnrealCLR::Profiler::Stop));
+		IConsoleManager::Get().RegisterConsoleCommand(TEXT("UnrealCLR.Profiler.Dump"), TEXT("Prints the top N interop calls by inclusive time and saves all of them to a CSV file, usage: UnrealCLR.Profiler.Dump [N]"), FConsoleCommandWithArgsDelegate::CreateStatic(&UnrealCLR::Profiler::Dump));
+	}
+
+	void UnrealCLR::Profiler::UnregisterCommands() {
+		IConsoleManager::Get().UnregisterConsoleObject(TEXT("UnrealCLR.Profiler.Start"), false);
+		IConsoleManager::Get().UnregisterConsoleObject(TEXT("UnrealCLR.Profiler.Stop"), false);
+		IConsoleManager::Get().UnregisterConsoleObject(TEXT("UnrealCLR.Profiler.Dump"), false);
+	}
+#endif
+
+size_t UnrealCLR::Utility::Strcpy(char* Destination, const char* Source, size_t Length) {
+	char* destination = Destination;
+	const char* source = Source;
+	size_t length = Length;
+
+	if (length != 0 && --length != 0) {
+		do {
+			if ((*destination++ = *source++) == 0)
+				break;
+		}
+
+		while (--length != 0);
+	}
+
+	if (length == 0) {
+		if (Length != 0)
+			*destination = '\0';
+
+		while (*source++);
+	}
+
+	return (source - Source - 1);
+}
+
+size_t UnrealCLR::Utility::Strlen(const char* Source) {
+	return strlen(Source) + 1;
+}
+
+int32 UnrealCLR::Utility::CopyHits(const TArray<FHitResult>& Source, UnrealCLRFramework::Hit* Destination, int32 Length) {
+	const int32 elements = Source.Num();
+
+	for (int32 i = 0, count = FMath::Min(elements, Length); i < count; i++) {
+		Destination[i] = Source[i];
+	}
+
+	return elements;
+}
+
+int32 UnrealCLR::Utility::CopyOverlaps(const TArray<FOverlapResult>& Source, UPrimitiveComponent** Destination, int32 Length) {
+	const int32 elements = Source.Num();
+
+	for (int32 i = 0, count = FMath::Min(elements, Length); i < count; i++) {
+		Destination[i] = Source[i].GetComponent();
+	}
+
+	return elements;
+}
+
+int32 UnrealCLR::Utility::GetHitStride(UnrealCLRFramework::HitFields Fields) {
+	// Sizes of the fields in the order of their flags, pointers are placed first to keep them aligned
+	static const int32 sizes[] = {
+		sizeof(AActor*),
+		sizeof(UPrimitiveComponent*),
+		sizeof(UnrealCLRFramework::Vector3),
+		sizeof(UnrealCLRFramework::Vector3),
+		sizeof(UnrealCLRFramework::Vector3),
+		sizeof(UnrealCLRFramework::Vector3),
+		sizeof(float),
+		sizeof(float),
+		sizeof(float),
+		sizeof(int32),
+		sizeof(int32)
+	};
+
+	const int32 fields = static_cast<int32>(Fields);
+	int32 stride = 0;
+
+	for (int32 i = 0; i < static_cast<int32>(UE_ARRAY_COUNT(sizes)); i++) {
+		if (fields & (1 << i))
+			stride += sizes[i];
+	}
+
+	return Align(stride, static_cast<int32>(sizeof(void*)));
+}
+
+void UnrealCLR::Utility::PackHit(const FHitResult& Hit, UnrealCLRFramework::HitFields Fields, uint8* Buffer) {
+	using UnrealCLRFramework::HitFields;
+
+	const int32 fields = static_cast<int32>(Fields);
+	uint8* buffer = Buffer;
+
+	auto write = [&buffer](const auto& Value) {
+		FMemory::Memcpy(buffer, &Value, sizeof(Value));
+		buffer += sizeof(Value);
+	};
+
+	if (fields & static_cast<int32>(HitFields::Actor))
+		write(Hit.GetActor());
+
+	if (fields & static_cast<int32>(HitFields::Component))
+		write(Hit.GetComponent());
+
+	if (fields & static_cast<int32>(HitFields::Location))
+		write(UnrealCLRFramework::Vector3(Hit.Location));
+
+	if (fields & static_cast<int32>(HitFields::ImpactLocation))
+		write(UnrealCLRFramework::Vector3(Hit.ImpactPoint));
+
+	if (fields & static_cast<int32>(HitFields::Normal))
+		write(UnrealCLRFramework::Vector3(Hit.Normal));
+
+	if (fields & static_cast<int32>(HitFields::ImpactNormal))
+		write(UnrealCLRFramework::Vector3(Hit.ImpactNormal));
+
+	if (fields & static_cast<int32>(HitFields::Time))
+		write(static_cast<float>(Hit.Time));
+
+	if (fields & static_cast<int32>(HitFields::Distance))
+		write(static_cast<float>(Hit.Distance));
+
+	if (fields & static_cast<int32>(HitFields::PenetrationDepth))
+		write(static_cast<float>(Hit.PenetrationDepth));
+
+	if (fields & static_cast<int32>(HitFields::BoneIndex)) {
+		int32 boneIndex = INDEX_NONE;
+
+		if (Hit.BoneName != NAME_None) {
+			const USkinnedMeshComponent* skinnedMeshComponent = Cast<USkinnedMeshComponent>(Hit.GetComponent());
+
+			if (skinnedMeshComponent)
+				boneIndex = skinnedMeshComponent->GetBoneIndex(Hit.BoneName);
+		}
+
+		write(boneIndex);
+	}
+
+	if (fields & static_cast<int32>(HitFields::Flags))
+		write(static_cast<int32>((Hit.bBlockingHit ? 1 : 0) | (Hit.bStartPenetrating ? 2 : 0)));
+}
+
+int32 UnrealCLR::Utility::PackHits(const TArray<FHitResult>& Source, UnrealCLRFramework::HitFields Fields, uint8* Destination, int32 Length) {
+	const int32 elements = Source.Num();
+	const int32 stride = GetHitStride(Fields);
+
+	for (int32 i = 0, count = FMath::Min(elements, Length); i < count; i++) {
+		PackHit(Source[i], Fields, Destination + i * stride);
+	}
+
+	return elements;
 }
 
 #undef LOCTEXT_NAMESPACE
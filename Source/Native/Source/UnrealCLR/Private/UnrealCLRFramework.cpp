@@ -297,6 +297,20 @@ namespace UnrealCLRFramework {
 		else\
 			boneName = FName(UTF8_TO_TCHAR(Name));
 
+	#define UNREALCLR_COLLISION_QUERY(Descriptor, Method, ...)\
+		(Descriptor->ObjectParams.IsValid() ?\
+			UnrealCLR::Engine::World->Method##ByObjectType(__VA_ARGS__, Descriptor->ObjectParams, Descriptor->Params) :\
+		Descriptor->Profile != NAME_None ?\
+			UnrealCLR::Engine::World->Method##ByProfile(__VA_ARGS__, Descriptor->Profile, Descriptor->Params) :\
+			UnrealCLR::Engine::World->Method##ByChannel(__VA_ARGS__, Descriptor->Channel, Descriptor->Params))
+
+	#define UNREALCLR_COLLISION_SHAPE_QUERY(Descriptor, Method, Shape, ...)\
+		(Descriptor->ObjectParams.IsValid() ?\
+			UnrealCLR::Engine::World->Method##ByObjectType(__VA_ARGS__, Descriptor->ObjectParams, Shape, Descriptor->Params) :\
+		Descriptor->Profile != NAME_None ?\
+			UnrealCLR::Engine::World->Method##ByProfile(__VA_ARGS__, Descriptor->Profile, Shape, Descriptor->Params) :\
+			UnrealCLR::Engine::World->Method##ByChannel(__VA_ARGS__, Descriptor->Channel, Shape, Descriptor->Params))
+
 	#define UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent)\
 		FCollisionQueryParams queryParams;\
 		if (IgnoredActor)\
@@ -309,7 +323,8 @@ namespace UnrealCLRFramework {
 		component->OnComponentCreated();\
 		component->RegisterComponent();\
 		if (Name)\
-			component->Rename(*FString(UTF8_TO_TCHAR(Name)));
+			component->Rename(*FString(UTF8_TO_TCHAR(Name)));\
+		UnrealCLR::Engine::Manager->InvalidateComponents(Actor);
 
 	#define UNREALCLR_SET_ACTOR_EVENT(Type, Condition, Method) {\
 		switch (Type) {\
@@ -408,6 +423,7 @@ namespace UnrealCLRFramework {
 	static_assert(InputEvent::IE_MAX == InputEvent(5), "Invalid elements count of the [InputEvent] enumeration");
 	static_assert(NetMode::NM_MAX == NetMode(4), "Invalid elements count of the [NetMode] enumeration");
 	static_assert(PixelFormat::PF_MAX == PixelFormat(UNREALCLR_PIXEL_FORMAT), "Invalid elements count of the [PixelFormat] enumeration");
+	static_assert(TickGroup::NewlySpawned == TickGroup(TG_NewlySpawned), "Invalid elements of the [TickGroup] enumeration");
 
 	static_assert(sizeof(Bounds) == 28, "Invalid size of the [Bounds] structure");
 	static_assert(sizeof(CollisionShape) == 16, "Invalid size of the [CollisionShape] structure");
@@ -418,7 +434,13 @@ namespace UnrealCLRFramework {
 
 			UE_LOG(LogUnrealManaged, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *message);
 
-			GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *message);
+			if (IsInGameThread()) {
+				GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *message);
+			} else {
+				AsyncTask(ENamedThreads::GameThread, [message]() {
+					GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *message);
+				});
+			}
 		}
 	}
 
@@ -454,7 +476,15 @@ namespace UnrealCLRFramework {
 		}
 
 		void Exception(const char* Message) {
-			GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *FString(UTF8_TO_TCHAR(Message)));
+			FString message(UTF8_TO_TCHAR(Message));
+
+			if (IsInGameThread()) {
+				GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *message);
+			} else {
+				AsyncTask(ENamedThreads::GameThread, [message]() {
+					GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *message);
+				});
+			}
 		}
 
 		void AddOnScreenMessage(int32 Key, float TimeToDisplay, Color DisplayColor, const char* Message) {
@@ -580,7 +610,13 @@ namespace UnrealCLRFramework {
 		void Rename(UObject* Object, const char* Name) {
 			FString name(UTF8_TO_TCHAR(Name));
 
-			Object->Rename(*name);
+			if (AActor* actor = Cast<AActor>(Object))
+				UnrealCLR::Indexing::Rename(actor, *name);
+			else
+				Object->Rename(*name);
+
+			if (UActorComponent* component = Cast<UActorComponent>(Object))
+				UnrealCLR::Engine::Manager->InvalidateComponents(component->GetOwner());
 		}
 
 		bool Invoke(UObject* Object, const char* Command) {
@@ -796,6 +832,429 @@ namespace UnrealCLRFramework {
 		}
 	}
 
+	namespace Jobs {
+		int32 Schedule(JobDelegate Callback, void* State, const int32* Prerequisites, int32 PrerequisitesCount) {
+			FGraphEventArray prerequisites;
+
+			if (!UnrealCLR::Jobs::Gather(Prerequisites, PrerequisitesCount, prerequisites))
+				return -1;
+
+			return UnrealCLR::Jobs::Add(FFunctionGraphTask::CreateAndDispatchWhenReady([Callback, State]() {
+				Callback(State, 0, 1);
+			}, TStatId(), &prerequisites, ENamedThreads::AnyThread));
+		}
+
+		int32 ScheduleParallel(JobDelegate Callback, void* State, int32 Count, int32 BatchSize, const int32* Prerequisites, int32 PrerequisitesCount) {
+			FGraphEventArray prerequisites;
+			FGraphEventArray batches;
+
+			if (!UnrealCLR::Jobs::Gather(Prerequisites, PrerequisitesCount, prerequisites))
+				return -1;
+
+			BatchSize = FMath::Max(BatchSize, 1);
+
+			for (int32 begin = 0; begin < Count; begin += BatchSize) {
+				const int32 end = FMath::Min(begin + BatchSize, Count);
+
+				batches.Add(FFunctionGraphTask::CreateAndDispatchWhenReady([Callback, State, begin, end]() {
+					Callback(State, begin, end);
+				}, TStatId(), &prerequisites, ENamedThreads::AnyThread));
+			}
+
+			return UnrealCLR::Jobs::Add(FFunctionGraphTask::CreateAndDispatchWhenReady([]() { }, TStatId(), &batches, ENamedThreads::AnyThread));
+		}
+
+		bool IsCompleted(int32 Handle) {
+			FGraphEventRef event = UnrealCLR::Jobs::Find(Handle);
+
+			return !event.IsValid() || event->IsComplete();
+		}
+
+		void Wait(int32 Handle) {
+			FGraphEventRef event = UnrealCLR::Jobs::Find(Handle);
+
+			if (event.IsValid())
+				FTaskGraphInterface::Get().WaitUntilTaskCompletes(event);
+		}
+
+		void Release(int32 Handle) {
+			UnrealCLR::Jobs::Remove(Handle);
+		}
+	}
+
+	namespace SpatialHash {
+		void SetCellSize(float CellSize) {
+			UnrealCLR::SpatialHash::SetCellSize(CellSize);
+		}
+
+		bool Add(AActor* Actor) {
+			return UnrealCLR::SpatialHash::Add(Actor);
+		}
+
+		bool Remove(AActor* Actor) {
+			return UnrealCLR::SpatialHash::Remove(Actor);
+		}
+
+		int32 QueryRadius(const Vector3* Center, float Radius, AActor** Actors, int32 Length) {
+			return UnrealCLR::SpatialHash::QueryRadius(*Center, Radius, Actors, Length);
+		}
+
+		int32 QueryBox(const Vector3* Min, const Vector3* Max, AActor** Actors, int32 Length) {
+			return UnrealCLR::SpatialHash::QueryBox(*Min, *Max, Actors, Length);
+		}
+
+		int32 QueryKNearest(const Vector3* Center, float MaxDistance, AActor** Actors, int32 Length) {
+			return UnrealCLR::SpatialHash::QueryKNearest(*Center, MaxDistance, Actors, Length);
+		}
+	}
+
+	namespace Handles {
+		void* GetTable() {
+			return &UnrealCLR::Handles::SharedTable;
+		}
+
+		uint64 Acquire(AActor* Actor) {
+			return UnrealCLR::Handles::Acquire(Actor);
+		}
+	}
+
+	namespace Mirror {
+		void* GetTable() {
+			return &UnrealCLR::Mirror::SharedTable;
+		}
+
+		int32 Add(AActor* Actor) {
+			return UnrealCLR::Mirror::Add(Actor);
+		}
+
+		bool Remove(AActor* Actor) {
+			return UnrealCLR::Mirror::Remove(Actor);
+		}
+	}
+
+	namespace ActorPool {
+		UClass* GetClass(ActorType Type, UObject* Blueprint) {
+			TSubclassOf<AActor> type;
+
+			if (!Blueprint) {
+				UNREALCLR_GET_ACTOR_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
+			} else {
+				#if !WITH_EDITOR
+					type = Cast<UClass>(Blueprint);
+				#else
+					type = Cast<UBlueprint>(Blueprint)->GeneratedClass;
+				#endif
+			}
+
+			return type;
+		}
+
+		AActor* Acquire(ActorType Type, UObject* Blueprint, const Transform* Transform) {
+			UClass* type = GetClass(Type, Blueprint);
+
+			if (!type)
+				return nullptr;
+
+			return UnrealCLR::Pooling::Acquire(type, *Transform);
+		}
+
+		bool Release(AActor* Actor) {
+			return UnrealCLR::Pooling::Release(Actor);
+		}
+
+		void Prewarm(ActorType Type, UObject* Blueprint, int32 Count) {
+			UClass* type = GetClass(Type, Blueprint);
+
+			if (type)
+				UnrealCLR::Pooling::Prewarm(type, Count);
+		}
+	}
+
+	namespace CollisionQuery {
+		int32 Create(CollisionChannel Channel, const char* ProfileName, bool TraceComplex) {
+			return UnrealCLR::CollisionQueries::Create(Channel, ProfileName ? FName(UTF8_TO_TCHAR(ProfileName)) : NAME_None, TraceComplex);
+		}
+
+		bool Destroy(int32 Handle) {
+			return UnrealCLR::CollisionQueries::Destroy(Handle);
+		}
+
+		bool AddIgnoredActor(int32 Handle, AActor* Actor) {
+			UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor || !Actor)
+				return false;
+
+			descriptor->Params.AddIgnoredActor(Actor);
+
+			return true;
+		}
+
+		bool AddIgnoredComponent(int32 Handle, UPrimitiveComponent* Component) {
+			UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor || !Component)
+				return false;
+
+			descriptor->Params.AddIgnoredComponent(Component);
+
+			return true;
+		}
+
+		bool ClearIgnored(int32 Handle) {
+			UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			FCollisionQueryParams queryParams;
+
+			queryParams.bTraceComplex = descriptor->Params.bTraceComplex;
+			queryParams.MobilityType = descriptor->Params.MobilityType;
+
+			descriptor->Params = queryParams;
+
+			return true;
+		}
+
+		bool AddObjectType(int32 Handle, CollisionChannel ObjectType) {
+			UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			descriptor->ObjectParams.AddObjectTypesToQuery(ObjectType);
+
+			return true;
+		}
+
+		bool SetMobility(int32 Handle, QueryMobility Mobility) {
+			UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			descriptor->Params.MobilityType = Mobility;
+
+			return true;
+		}
+
+		bool SetTraceComplex(int32 Handle, bool Value) {
+			UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			descriptor->Params.bTraceComplex = Value;
+
+			return true;
+		}
+
+		bool LineTraceTest(int32 Handle, const Vector3* Start, const Vector3* End) {
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			return UNREALCLR_COLLISION_QUERY(descriptor, LineTraceTest, *Start, *End);
+		}
+
+		bool LineTraceSingle(int32 Handle, const Vector3* Start, const Vector3* End, Hit* Hit) {
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			FHitResult hit;
+
+			bool result = UNREALCLR_COLLISION_QUERY(descriptor, LineTraceSingle, hit, *Start, *End);
+
+			*Hit = hit;
+
+			return result;
+		}
+
+		int32 LineTraceMulti(int32 Handle, const Vector3* Start, const Vector3* End, Hit* Hits, int32 Length) {
+			TArray<FHitResult> hits;
+
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return 0;
+
+			UNREALCLR_COLLISION_QUERY(descriptor, LineTraceMulti, hits, *Start, *End);
+
+			return UnrealCLR::Utility::CopyHits(hits, Hits, Length);
+		}
+
+		int32 LineTraceBatch(int32 Handle, const Vector3* Starts, const Vector3* Ends, int32 Count, Hit* Hits, uint8* HitMask) {
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return 0;
+
+			FHitResult hit;
+			int32 hits = 0;
+
+			FMemory::Memzero(HitMask, (Count + 7) / 8);
+
+			for (int32 i = 0; i < Count; i++) {
+				bool result = false;
+
+				if (Hits) {
+					result = UNREALCLR_COLLISION_QUERY(descriptor, LineTraceSingle, hit, Starts[i], Ends[i]);
+					Hits[i] = hit;
+				} else {
+					result = UNREALCLR_COLLISION_QUERY(descriptor, LineTraceTest, Starts[i], Ends[i]);
+				}
+
+				if (result) {
+					HitMask[i >> 3] |= static_cast<uint8>(1 << (i & 7));
+					hits++;
+				}
+			}
+
+			return hits;
+		}
+
+		bool SweepTest(int32 Handle, const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const CollisionShape* Shape) {
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			return UNREALCLR_COLLISION_SHAPE_QUERY(descriptor, SweepTest, *Shape, *Start, *End, *Rotation);
+		}
+
+		bool SweepSingle(int32 Handle, const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const CollisionShape* Shape, Hit* Hit) {
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			FHitResult hit;
+
+			bool result = UNREALCLR_COLLISION_SHAPE_QUERY(descriptor, SweepSingle, *Shape, hit, *Start, *End, *Rotation);
+
+			*Hit = hit;
+
+			return result;
+		}
+
+		int32 SweepMulti(int32 Handle, const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const CollisionShape* Shape, Hit* Hits, int32 Length) {
+			TArray<FHitResult> hits;
+
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return 0;
+
+			UNREALCLR_COLLISION_SHAPE_QUERY(descriptor, SweepMulti, *Shape, hits, *Start, *End, *Rotation);
+
+			return UnrealCLR::Utility::CopyHits(hits, Hits, Length);
+		}
+
+		bool OverlapAnyTest(int32 Handle, const Vector3* Location, const Quaternion* Rotation, const CollisionShape* Shape) {
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return false;
+
+			return UNREALCLR_COLLISION_SHAPE_QUERY(descriptor, OverlapAnyTest, *Shape, *Location, *Rotation);
+		}
+
+		int32 OverlapMulti(int32 Handle, const Vector3* Location, const Quaternion* Rotation, const CollisionShape* Shape, UPrimitiveComponent** Components, int32 Length) {
+			TArray<FOverlapResult> overlaps;
+
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return 0;
+
+			UNREALCLR_COLLISION_SHAPE_QUERY(descriptor, OverlapMulti, *Shape, overlaps, *Location, *Rotation);
+
+			return UnrealCLR::Utility::CopyOverlaps(overlaps, Components, Length);
+		}
+
+		int32 LineTraceMultiCompact(int32 Handle, const Vector3* Start, const Vector3* End, HitFields Fields, uint8* Hits, int32 Length) {
+			TArray<FHitResult> hits;
+
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return 0;
+
+			UNREALCLR_COLLISION_QUERY(descriptor, LineTraceMulti, hits, *Start, *End);
+
+			return UnrealCLR::Utility::PackHits(hits, Fields, Hits, Length);
+		}
+
+		int32 LineTraceBatchCompact(int32 Handle, const Vector3* Starts, const Vector3* Ends, int32 Count, HitFields Fields, uint8* Hits, uint8* HitMask) {
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return 0;
+
+			const int32 stride = UnrealCLR::Utility::GetHitStride(Fields);
+			FHitResult hit;
+			int32 hits = 0;
+
+			FMemory::Memzero(HitMask, (Count + 7) / 8);
+
+			for (int32 i = 0; i < Count; i++) {
+				if (UNREALCLR_COLLISION_QUERY(descriptor, LineTraceSingle, hit, Starts[i], Ends[i])) {
+					UnrealCLR::Utility::PackHit(hit, Fields, Hits + i * stride);
+					HitMask[i >> 3] |= static_cast<uint8>(1 << (i & 7));
+					hits++;
+				} else {
+					FMemory::Memzero(Hits + i * stride, stride);
+				}
+			}
+
+			return hits;
+		}
+
+		int32 SweepMultiCompact(int32 Handle, const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const CollisionShape* Shape, HitFields Fields, uint8* Hits, int32 Length) {
+			TArray<FHitResult> hits;
+
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return 0;
+
+			UNREALCLR_COLLISION_SHAPE_QUERY(descriptor, SweepMulti, *Shape, hits, *Start, *End, *Rotation);
+
+			return UnrealCLR::Utility::PackHits(hits, Fields, Hits, Length);
+		}
+
+		int32 SweepBatchCompact(int32 Handle, const Vector3* Starts, const Vector3* Ends, const Quaternion* Rotations, int32 Count, const CollisionShape* Shape, HitFields Fields, uint8* Hits, uint8* HitMask) {
+			const UnrealCLR::CollisionQueries::Descriptor* descriptor = UnrealCLR::CollisionQueries::Find(Handle);
+
+			if (!descriptor)
+				return 0;
+
+			const int32 stride = UnrealCLR::Utility::GetHitStride(Fields);
+			FHitResult hit;
+			int32 hits = 0;
+
+			FMemory::Memzero(HitMask, (Count + 7) / 8);
+
+			for (int32 i = 0; i < Count; i++) {
+				const FQuat rotation = Rotations ? FQuat(Rotations[i]) : FQuat::Identity;
+
+				if (UNREALCLR_COLLISION_SHAPE_QUERY(descriptor, SweepSingle, *Shape, hit, Starts[i], Ends[i], rotation)) {
+					UnrealCLR::Utility::PackHit(hit, Fields, Hits + i * stride);
+					HitMask[i >> 3] |= static_cast<uint8>(1 << (i & 7));
+					hits++;
+				} else {
+					FMemory::Memzero(Hits + i * stride, stride);
+				}
+			}
+
+			return hits;
+		}
+	}
+
 	namespace Asset {
 		bool IsValid(FAssetData* Asset) {
 			return Asset->IsValid();
@@ -836,23 +1295,22 @@ namespace UnrealCLRFramework {
 		}
 
 		void ForEachAsset(IAssetRegistry* AssetRegistry, const char* Path, bool Recursive, bool IncludeOnlyOnDiskAssets, FAssetData** Array, int32* Elements) {
-			static TArray<FAssetData> assets;
-			static TArray<FAssetData*> references;
-
-			assets.Reset();
-			references.Reset();
+			TArray<FAssetData> assets;
 
 			AssetRegistry->GetAssetsByPath(FName(UTF8_TO_TCHAR(Path)), assets, Recursive, IncludeOnlyOnDiskAssets);
 
 			int32 elements = assets.Num();
 
 			if (elements > 0) {
+				FAssetData* data = UnrealCLR::Arena::Move(assets);
+				FAssetData** references = UnrealCLR::Arena::Allocate<FAssetData*>(elements);
+
 				for (int32 i = 0; i < elements; i++) {
-					references.Add(&assets[i]);
+					references[i] = &data[i];
 				}
 
-				*Array = reinterpret_cast<FAssetData*>(references.GetData());
-				*Elements = references.Num();
+				*Array = reinterpret_cast<FAssetData*>(references);
+				*Elements = elements;
 			}
 		}
 	}
@@ -1090,21 +1548,51 @@ namespace UnrealCLRFramework {
 	}
 
 	namespace World {
-		void ForEachActor(AActor** Array, int32* Elements) {
-			static TArray<AActor*> actors;
+		int32 GetActors(ActorType Type, int64* Cursor, AActor** Actors, int32 Length) {
+			TSubclassOf<AActor> type;
+			int32 elements = 0;
+
+			UNREALCLR_GET_ACTOR_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
+
+			if (Cursor) {
+				const TArray<ULevel*>& levels = UnrealCLR::Engine::World->GetLevels();
+				int32 level = static_cast<int32>(*Cursor >> 32);
+				int32 index = static_cast<int32>(*Cursor & 0xFFFFFFFF);
+
+				// Actors of visible levels are walked by index to continue where the previous call stopped once the buffer is full
+				for (; level < levels.Num(); level++, index = 0) {
+					if (!levels[level] || !levels[level]->bIsVisible)
+						continue;
+
+					const auto& actors = levels[level]->Actors;
+
+					for (; index < actors.Num(); index++) {
+						if (elements == Length) {
+							*Cursor = (static_cast<int64>(level) << 32) | index;
+
+							return elements;
+						}
+
+						AActor* actor = actors[index];
+
+						if (actor && !actor->IsPendingKill() && actor->IsA(type))
+							Actors[elements++] = actor;
+					}
+				}
 
-			actors.Reset();
+				*Cursor = static_cast<int64>(level) << 32;
 
-			for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World); currentActor; ++currentActor) {
-				actors.Add(*currentActor);
+				return elements;
 			}
 
-			int32 elements = actors.Num();
+			for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World, type); currentActor; ++currentActor) {
+				if (elements < Length)
+					Actors[elements] = *currentActor;
 
-			if (elements > 0) {
-				*Array = reinterpret_cast<AActor*>(actors.GetData());
-				*Elements = elements;
+				elements++;
 			}
+
+			return elements;
 		}
 
 		int32 GetActorCount() {
@@ -1142,56 +1630,62 @@ namespace UnrealCLRFramework {
 		}
 
 		AActor* GetActor(const char* Name, ActorType Type) {
-			FString name;
 			AActor* actor = nullptr;
 			TSubclassOf<AActor> type;
 
-			if (Name)
-				name = FString(UTF8_TO_TCHAR(Name));
-
 			UNREALCLR_GET_ACTOR_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
-			for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World, type); currentActor; ++currentActor) {
-				if (!Name || (Name && *currentActor->GetName() == name)) {
+			if (Name) {
+				FName name(UTF8_TO_TCHAR(Name), FNAME_Find);
+
+				if (name != NAME_None)
+					actor = UnrealCLR::Indexing::FindByName(name, type);
+			} else {
+				TActorIterator<AActor> currentActor(UnrealCLR::Engine::World, type);
+
+				if (currentActor)
 					actor = *currentActor;
-					break;
-				}
 			}
 
 			return actor;
 		}
 
 		AActor* GetActorByTag(const char* Tag, ActorType Type) {
-			AActor* actor = nullptr;
 			TSubclassOf<AActor> type;
-			FName tag(UTF8_TO_TCHAR(Tag));
+			FName tag(UTF8_TO_TCHAR(Tag), FNAME_Find);
 
 			UNREALCLR_GET_ACTOR_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
-			for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World, type); currentActor; ++currentActor) {
-				if (currentActor->ActorHasTag(tag)) {
-					actor = *currentActor;
-					break;
-				}
-			}
+			if (tag == NAME_None)
+				return nullptr;
 
-			return actor;
+			return UnrealCLR::Indexing::FindByTag(tag, type);
 		}
 
-		AActor* GetActorByID(uint32 ID, ActorType Type) {
-			AActor* actor = nullptr;
+		void GetActorsByTag(const char* Tag, ActorType Type, AActor** Array, int32* Elements) {
+			TArray<AActor*> actors;
 			TSubclassOf<AActor> type;
+			FName tag(UTF8_TO_TCHAR(Tag), FNAME_Find);
 
 			UNREALCLR_GET_ACTOR_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
-			for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World, type); currentActor; ++currentActor) {
-				if (currentActor->GetUniqueID() == ID) {
-					actor = *currentActor;
-					break;
-				}
+			if (tag != NAME_None)
+				UnrealCLR::Indexing::FindAllByTag(tag, type, actors);
+
+			int32 elements = actors.Num();
+
+			if (elements > 0) {
+				*Array = reinterpret_cast<AActor*>(UnrealCLR::Arena::Move(actors));
+				*Elements = elements;
 			}
+		}
 
-			return actor;
+		AActor* GetActorByID(uint32 ID, ActorType Type) {
+			TSubclassOf<AActor> type;
+
+			UNREALCLR_GET_ACTOR_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
+
+			return UnrealCLR::Indexing::FindByID(ID, type);
 		}
 
 		APlayerController* GetFirstPlayerController() {
@@ -1258,6 +1752,62 @@ namespace UnrealCLRFramework {
 			UnrealCLR::Shared::Events[UnrealCLR::OnComponentReleased] = (void*)Callback;
 		}
 
+		void SetEventsBatching(EventsBatchDelegate Callback) {
+			if (!Callback)
+				UnrealCLR::Batching::Dispatch();
+
+			UnrealCLR::Shared::Events[UnrealCLR::OnEventsBatch] = (void*)Callback;
+		}
+
+		bool SetRunOnAnyThread(TickGroup Group, bool Value) {
+			return UnrealCLR::Threading::SetRunOnAnyThread(static_cast<ETickingGroup>(Group), Value);
+		}
+
+		int32 RegisterTickFunction(TickDelegate Callback, TickGroup Group, float TickInterval, bool TickEvenWhenPaused) {
+			return UnrealCLR::Ticking::Register(Callback, static_cast<ETickingGroup>(Group), TickInterval, TickEvenWhenPaused);
+		}
+
+		bool UnregisterTickFunction(int32 Handle) {
+			return UnrealCLR::Ticking::Unregister(Handle);
+		}
+
+		bool SetTickFunctionEnabled(int32 Handle, bool Value) {
+			UnrealCLR::CustomTickFunction* tickFunction = UnrealCLR::Ticking::Find(Handle);
+
+			if (!tickFunction)
+				return false;
+
+			tickFunction->SetTickFunctionEnable(Value);
+
+			return true;
+		}
+
+		bool AddTickPrerequisiteActor(int32 Handle, AActor* Actor) {
+			UnrealCLR::CustomTickFunction* tickFunction = UnrealCLR::Ticking::Find(Handle);
+
+			if (!tickFunction || !Actor)
+				return false;
+
+			tickFunction->AddPrerequisite(Actor, Actor->PrimaryActorTick);
+
+			return true;
+		}
+
+		bool AddTickPrerequisiteComponent(int32 Handle, UActorComponent* Component) {
+			UnrealCLR::CustomTickFunction* tickFunction = UnrealCLR::Ticking::Find(Handle);
+
+			if (!tickFunction || !Component)
+				return false;
+
+			tickFunction->AddPrerequisite(Component, Component->PrimaryComponentTick);
+
+			return true;
+		}
+
+		void SetFixedTick(float StepTime, int32 MaxSubsteps) {
+			UnrealCLR::FixedTick::Set(StepTime, MaxSubsteps);
+		}
+
 		void SetSimulatePhysics(bool Value) {
 			UnrealCLR::Engine::World->bShouldSimulatePhysics = Value;
 		}
@@ -1396,6 +1946,171 @@ namespace UnrealCLRFramework {
 
 			return UnrealCLR::Engine::World->OverlapBlockingTestByProfile(*Location, *Rotation, FName(UTF8_TO_TCHAR(ProfileName)), *Shape, queryParams);
 		}
+
+		int32 LineTraceMultiByChannel(const Vector3* Start, const Vector3* End, CollisionChannel Channel, Hit* Hits, int32 Length, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			TArray<FHitResult> hits;
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			queryParams.bTraceComplex = TraceComplex;
+
+			UnrealCLR::Engine::World->LineTraceMultiByChannel(hits, *Start, *End, Channel, queryParams);
+
+			return UnrealCLR::Utility::CopyHits(hits, Hits, Length);
+		}
+
+		int32 LineTraceMultiByProfile(const Vector3* Start, const Vector3* End, const char* ProfileName, Hit* Hits, int32 Length, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			TArray<FHitResult> hits;
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			queryParams.bTraceComplex = TraceComplex;
+
+			UnrealCLR::Engine::World->LineTraceMultiByProfile(hits, *Start, *End, FName(UTF8_TO_TCHAR(ProfileName)), queryParams);
+
+			return UnrealCLR::Utility::CopyHits(hits, Hits, Length);
+		}
+
+		int32 SweepMultiByChannel(const Vector3* Start, const Vector3* End, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, Hit* Hits, int32 Length, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			TArray<FHitResult> hits;
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			queryParams.bTraceComplex = TraceComplex;
+
+			UnrealCLR::Engine::World->SweepMultiByChannel(hits, *Start, *End, *Rotation, Channel, *Shape, queryParams);
+
+			return UnrealCLR::Utility::CopyHits(hits, Hits, Length);
+		}
+
+		int32 SweepMultiByProfile(const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const char* ProfileName, const CollisionShape* Shape, Hit* Hits, int32 Length, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			TArray<FHitResult> hits;
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			queryParams.bTraceComplex = TraceComplex;
+
+			UnrealCLR::Engine::World->SweepMultiByProfile(hits, *Start, *End, *Rotation, FName(UTF8_TO_TCHAR(ProfileName)), *Shape, queryParams);
+
+			return UnrealCLR::Utility::CopyHits(hits, Hits, Length);
+		}
+
+		int32 OverlapMultiByChannel(const Vector3* Location, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, UPrimitiveComponent** Components, int32 Length, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			TArray<FOverlapResult> overlaps;
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			UnrealCLR::Engine::World->OverlapMultiByChannel(overlaps, *Location, *Rotation, Channel, *Shape, queryParams);
+
+			return UnrealCLR::Utility::CopyOverlaps(overlaps, Components, Length);
+		}
+
+		int32 OverlapMultiByProfile(const Vector3* Location, const Quaternion* Rotation, const char* ProfileName, const CollisionShape* Shape, UPrimitiveComponent** Components, int32 Length, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			TArray<FOverlapResult> overlaps;
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			UnrealCLR::Engine::World->OverlapMultiByProfile(overlaps, *Location, *Rotation, FName(UTF8_TO_TCHAR(ProfileName)), *Shape, queryParams);
+
+			return UnrealCLR::Utility::CopyOverlaps(overlaps, Components, Length);
+		}
+
+		int32 LineTraceBatchByChannel(const Vector3* Starts, const Vector3* Ends, int32 Count, CollisionChannel Channel, Hit* Hits, uint8* HitMask, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			FHitResult hit;
+			int32 hits = 0;
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			queryParams.bTraceComplex = TraceComplex;
+
+			FMemory::Memzero(HitMask, (Count + 7) / 8);
+
+			for (int32 i = 0; i < Count; i++) {
+				bool result = false;
+
+				if (Hits) {
+					result = UnrealCLR::Engine::World->LineTraceSingleByChannel(hit, Starts[i], Ends[i], Channel, queryParams);
+					Hits[i] = hit;
+				} else {
+					result = UnrealCLR::Engine::World->LineTraceTestByChannel(Starts[i], Ends[i], Channel, queryParams);
+				}
+
+				if (result) {
+					HitMask[i >> 3] |= static_cast<uint8>(1 << (i & 7));
+					hits++;
+				}
+			}
+
+			return hits;
+		}
+
+		int32 SweepBatchByChannel(const Vector3* Starts, const Vector3* Ends, const Quaternion* Rotations, int32 Count, CollisionChannel Channel, const CollisionShape* Shape, Hit* Hits, uint8* HitMask, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			FHitResult hit;
+			int32 hits = 0;
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			queryParams.bTraceComplex = TraceComplex;
+
+			FMemory::Memzero(HitMask, (Count + 7) / 8);
+
+			for (int32 i = 0; i < Count; i++) {
+				const FQuat rotation = Rotations ? FQuat(Rotations[i]) : FQuat::Identity;
+				bool result = false;
+
+				if (Hits) {
+					result = UnrealCLR::Engine::World->SweepSingleByChannel(hit, Starts[i], Ends[i], rotation, Channel, *Shape, queryParams);
+					Hits[i] = hit;
+				} else {
+					result = UnrealCLR::Engine::World->SweepTestByChannel(Starts[i], Ends[i], rotation, Channel, *Shape, queryParams);
+				}
+
+				if (result) {
+					HitMask[i >> 3] |= static_cast<uint8>(1 << (i & 7));
+					hits++;
+				}
+			}
+
+			return hits;
+		}
+
+		void SetOnAsyncQueriesCallback(AsyncQueriesDelegate Callback) {
+			UnrealCLR::Shared::Events[UnrealCLR::OnAsyncQueries] = (void*)Callback;
+		}
+
+		uint32 AsyncLineTraceByChannel(const Vector3* Start, const Vector3* End, CollisionChannel Channel, bool Multi, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			const uint32 ticket = UnrealCLR::AsyncQueries::Acquire();
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			queryParams.bTraceComplex = TraceComplex;
+
+			UnrealCLR::Engine::World->AsyncLineTraceByChannel(Multi ? EAsyncTraceType::Multi : EAsyncTraceType::Single, *Start, *End, Channel, queryParams, FCollisionResponseParams::DefaultResponseParam, &UnrealCLR::AsyncQueries::TraceDelegate, ticket);
+
+			return ticket;
+		}
+
+		uint32 AsyncSweepByChannel(const Vector3* Start, const Vector3* End, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, bool Multi, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			const uint32 ticket = UnrealCLR::AsyncQueries::Acquire();
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			queryParams.bTraceComplex = TraceComplex;
+
+			UnrealCLR::Engine::World->AsyncSweepByChannel(Multi ? EAsyncTraceType::Multi : EAsyncTraceType::Single, *Start, *End, *Rotation, Channel, *Shape, queryParams, FCollisionResponseParams::DefaultResponseParam, &UnrealCLR::AsyncQueries::TraceDelegate, ticket);
+
+			return ticket;
+		}
+
+		uint32 AsyncOverlapByChannel(const Vector3* Location, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent) {
+			const uint32 ticket = UnrealCLR::AsyncQueries::Acquire();
+
+			UNREALCLR_SET_COLLISION_QUERY_PARAMS(IgnoredActor, IgnoredComponent);
+
+			UnrealCLR::Engine::World->AsyncOverlapByChannel(*Location, *Rotation, Channel, *Shape, queryParams, FCollisionResponseParams::DefaultResponseParam, &UnrealCLR::AsyncQueries::OverlapDelegate, ticket);
+
+			return ticket;
+		}
 	}
 
 	namespace ConsoleObject {
@@ -1480,61 +2195,53 @@ namespace UnrealCLRFramework {
 		}
 
 		void ForEachComponent(AActor* Actor, UActorComponent** Array, int32* Elements) {
-			static TArray<UActorComponent*> components;
-
-			components.Reset();
+			TArray<UActorComponent*, TInlineAllocator<32>> components;
 
 			Actor->GetComponents(components);
 
 			int32 elements = components.Num();
 
 			if (elements > 0) {
-				*Array = reinterpret_cast<UActorComponent*>(components.GetData());
+				*Array = reinterpret_cast<UActorComponent*>(UnrealCLR::Arena::Move(components));
 				*Elements = elements;
 			}
 		}
 
 		void ForEachAttachedActor(AActor* Actor, AActor** Array, int32* Elements) {
-			static TArray<AActor*> actors;
-
-			actors.Reset();
+			TArray<AActor*> actors;
 
 			Actor->GetAttachedActors(actors);
 
 			int32 elements = actors.Num();
 
 			if (elements > 0) {
-				*Array = reinterpret_cast<AActor*>(actors.GetData());
+				*Array = reinterpret_cast<AActor*>(UnrealCLR::Arena::Move(actors));
 				*Elements = elements;
 			}
 		}
 
 		void ForEachChildActor(AActor* Actor, AActor** Array, int32* Elements) {
-			static TArray<AActor*> actors;
-
-			actors.Reset();
+			TArray<AActor*> actors;
 
 			Actor->GetAllChildActors(actors);
 
 			int32 elements = actors.Num();
 
 			if (elements > 0) {
-				*Array = reinterpret_cast<AActor*>(actors.GetData());
+				*Array = reinterpret_cast<AActor*>(UnrealCLR::Arena::Move(actors));
 				*Elements = elements;
 			}
 		}
 
 		void ForEachOverlappingActor(AActor* Actor, AActor** Array, int32* Elements) {
-			static TArray<AActor*> overlappingActors;
-
-			overlappingActors.Reset();
+			TArray<AActor*> overlappingActors;
 
 			Actor->GetOverlappingActors(overlappingActors);
 
 			int32 elements = overlappingActors.Num();
 
 			if (elements > 0) {
-				*Array = reinterpret_cast<AActor*>(overlappingActors.GetData());
+				*Array = reinterpret_cast<AActor*>(UnrealCLR::Arena::Move(overlappingActors));
 				*Elements = elements;
 			}
 		}
@@ -1555,7 +2262,7 @@ namespace UnrealCLRFramework {
 			if (actor && Name) {
 				FString name(UTF8_TO_TCHAR(Name));
 
-				actor->Rename(*name);
+				UnrealCLR::Indexing::Rename(actor, *name);
 
 				#if WITH_EDITOR
 					actor->SetActorLabel(*name);
@@ -1565,14 +2272,75 @@ namespace UnrealCLRFramework {
 			return actor;
 		}
 
+		AActor* SpawnDeferred(const char* Name, ActorType Type, UObject* Blueprint, const Transform* Transform) {
+			UClass* type = ActorPool::GetClass(Type, Blueprint);
+
+			if (!type)
+				return nullptr;
+
+			AActor* actor = UnrealCLR::Spawning::Begin(type, *Transform);
+
+			if (actor && Name) {
+				FString name(UTF8_TO_TCHAR(Name));
+
+				UnrealCLR::Indexing::Rename(actor, *name);
+
+				#if WITH_EDITOR
+					actor->SetActorLabel(*name);
+				#endif
+			}
+
+			return actor;
+		}
+
+		bool FinishSpawning(AActor* Actor) {
+			return UnrealCLR::Spawning::Finish(Actor);
+		}
+
+		int32 SpawnBatch(ActorType Type, UObject* Blueprint, const Transform* Transforms, int32 Count, bool Deferred, AActor** Actors) {
+			UClass* type = ActorPool::GetClass(Type, Blueprint);
+
+			if (!type)
+				return 0;
+
+			int32 spawned = 0;
+
+			for (int32 i = 0; i < Count; i++) {
+				AActor* actor = UnrealCLR::Spawning::Begin(type, Transforms[i]);
+
+				Actors[i] = actor;
+
+				if (actor)
+					spawned++;
+			}
+
+			if (!Deferred)
+				FinishSpawningBatch(Actors, Count);
+
+			return spawned;
+		}
+
+		int32 FinishSpawningBatch(AActor** Actors, int32 Count) {
+			int32 finished = 0;
+
+			for (int32 i = 0; i < Count; i++) {
+				if (Actors[i] && UnrealCLR::Spawning::Finish(Actors[i]))
+					finished++;
+			}
+
+			return finished;
+		}
+
 		bool Destroy(AActor* Actor) {
+			UnrealCLR::Engine::Manager->InvalidateComponents(Actor);
+
 			return UnrealCLR::Engine::World->DestroyActor(Actor);
 		}
 
 		void Rename(AActor* Actor, const char* Name) {
 			FString name(UTF8_TO_TCHAR(Name));
 
-			Actor->Rename(*name);
+			UnrealCLR::Indexing::Rename(Actor, *name);
 
 			#if WITH_EDITOR
 				Actor->SetActorLabel(*name);
@@ -1588,19 +2356,22 @@ namespace UnrealCLRFramework {
 		}
 
 		UActorComponent* GetComponent(AActor* Actor, const char* Name, ComponentType Type) {
-			FString name;
 			UActorComponent* component = nullptr;
 			TSubclassOf<UActorComponent> type;
 
-			if (Name)
-				name = FString(UTF8_TO_TCHAR(Name));
-
 			UNREALCLR_GET_COMPONENT_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
-			for (UActorComponent* currentComponent : Actor->GetComponents()) {
-				if (currentComponent && currentComponent->IsA(type) && (!Name || (Name && *currentComponent->GetName() == name))) {
-					component = currentComponent;
-					break;
+			if (Name) {
+				FName name(UTF8_TO_TCHAR(Name), FNAME_Find);
+
+				if (name != NAME_None)
+					component = UnrealCLR::Engine::Manager->FindComponent(Actor, name, type);
+			} else {
+				for (UActorComponent* currentComponent : Actor->GetComponents()) {
+					if (currentComponent && currentComponent->IsA(type)) {
+						component = currentComponent;
+						break;
+					}
 				}
 			}
 
@@ -1610,16 +2381,12 @@ namespace UnrealCLRFramework {
 		UActorComponent* GetComponentByTag(AActor* Actor, const char* Tag, ComponentType Type) {
 			UActorComponent* component = nullptr;
 			TSubclassOf<UActorComponent> type;
-			FName tag(UTF8_TO_TCHAR(Tag));
+			FName tag(UTF8_TO_TCHAR(Tag), FNAME_Find);
 
 			UNREALCLR_GET_COMPONENT_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
-			for (UActorComponent* currentComponent : Actor->GetComponents()) {
-				if (currentComponent->ComponentHasTag(tag)) {
-					component = currentComponent;
-					break;
-				}
-			}
+			if (tag != NAME_None)
+				component = UnrealCLR::Engine::Manager->FindComponentByTag(Actor, tag, type);
 
 			return component;
 		}
@@ -1630,12 +2397,7 @@ namespace UnrealCLRFramework {
 
 			UNREALCLR_GET_COMPONENT_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
-			for (UActorComponent* currentComponent : Actor->GetComponents()) {
-				if (currentComponent->GetUniqueID() == ID) {
-					component = currentComponent;
-					break;
-				}
-			}
+			component = UnrealCLR::Engine::Manager->FindComponentByID(Actor, ID, type);
 
 			return component;
 		}
@@ -1720,23 +2482,37 @@ namespace UnrealCLRFramework {
 		}
 
 		void AddTag(AActor* Actor, const char* Tag) {
-			Actor->Tags.AddUnique(FName(UTF8_TO_TCHAR(Tag)));
+			FName tag(UTF8_TO_TCHAR(Tag));
+
+			Actor->Tags.AddUnique(tag);
+
+			UnrealCLR::Indexing::AddTag(Actor, tag);
 		}
 
 		void RemoveTag(AActor* Actor, const char* Tag) {
-			Actor->Tags.Remove(FName(UTF8_TO_TCHAR(Tag)));
+			FName tag(UTF8_TO_TCHAR(Tag));
+
+			Actor->Tags.Remove(tag);
+
+			UnrealCLR::Indexing::RemoveTag(Actor, tag);
 		}
 
 		bool HasTag(AActor* Actor, const char* Tag) {
 			return Actor->ActorHasTag(FName(UTF8_TO_TCHAR(Tag)));
 		}
 
-		void RegisterEvent(AActor* Actor, ActorEventType Type) {
+		void RegisterEvent(AActor* Actor, ActorEventType Type, HitFilter Filter, float FilterValue) {
 			UNREALCLR_SET_ACTOR_EVENT(Type, !, AddDynamic);
+
+			if (Type == ActorEventType::OnActorHit)
+				UnrealCLR::Coalescing::SetFilter(Actor, Filter, FilterValue);
 		}
 
 		void UnregisterEvent(AActor* Actor, ActorEventType Type) {
 			UNREALCLR_SET_ACTOR_EVENT(Type, UNREALCLR_NONE, RemoveDynamic);
+
+			if (Type == ActorEventType::OnActorHit)
+				UnrealCLR::Coalescing::SetFilter(Actor, HitFilter::None, 0.0f);
 		}
 	}
 
@@ -2293,15 +3069,21 @@ namespace UnrealCLRFramework {
 		}
 
 		void Destroy(UActorComponent* ActorComponent, bool PromoteChild) {
+			UnrealCLR::Engine::Manager->InvalidateComponents(ActorComponent->GetOwner());
+
 			ActorComponent->DestroyComponent(PromoteChild);
 		}
 
 		void AddTag(UActorComponent* ActorComponent, const char* Tag) {
 			ActorComponent->ComponentTags.AddUnique(FName(UTF8_TO_TCHAR(Tag)));
+
+			UnrealCLR::Engine::Manager->InvalidateComponents(ActorComponent->GetOwner());
 		}
 
 		void RemoveTag(UActorComponent* ActorComponent, const char* Tag) {
 			ActorComponent->ComponentTags.Remove(FName(UTF8_TO_TCHAR(Tag)));
+
+			UnrealCLR::Engine::Manager->InvalidateComponents(ActorComponent->GetOwner());
 		}
 
 		bool HasTag(UActorComponent* ActorComponent, const char* Tag) {
@@ -2528,16 +3310,15 @@ namespace UnrealCLRFramework {
 		}
 
 		void ForEachAttachedChild(USceneComponent* SceneComponent, USceneComponent** Array, int32* Elements) {
-			static TArray<USceneComponent*> attachedComponents;
-
-			attachedComponents.Reset();
-
-			attachedComponents = SceneComponent->GetAttachChildren();
-
+			const TArray<USceneComponent*>& attachedComponents = SceneComponent->GetAttachChildren();
 			int32 elements = attachedComponents.Num();
 
 			if (elements > 0) {
-				*Array = reinterpret_cast<USceneComponent*>(attachedComponents.GetData());
+				USceneComponent** components = UnrealCLR::Arena::Allocate<USceneComponent*>(elements);
+
+				FMemory::Memcpy(components, attachedComponents.GetData(), elements * sizeof(USceneComponent*));
+
+				*Array = reinterpret_cast<USceneComponent*>(components);
 				*Elements = elements;
 			}
 		}
@@ -2718,6 +3499,59 @@ namespace UnrealCLRFramework {
 		void SetWorldTransform(USceneComponent* SceneComponent, const Transform* Transform) {
 			SceneComponent->SetWorldTransform(*Transform);
 		}
+
+		void GetComponentTransforms(USceneComponent** SceneComponents, int32 Count, Transform* Values) {
+			for (int32 i = 0; i < Count; i++) {
+				USceneComponent* sceneComponent = SceneComponents[i];
+
+				// Slots of invalid components are overwritten to not leave values of a previous call
+				Values[i] = sceneComponent && !sceneComponent->IsPendingKill() ? sceneComponent->GetComponentTransform() : FTransform::Identity;
+			}
+		}
+
+		void GetComponentLocations(USceneComponent** SceneComponents, int32 Count, Vector3* Values) {
+			for (int32 i = 0; i < Count; i++) {
+				USceneComponent* sceneComponent = SceneComponents[i];
+
+				Values[i] = sceneComponent && !sceneComponent->IsPendingKill() ? sceneComponent->GetComponentLocation() : FVector::ZeroVector;
+			}
+		}
+
+		void GetComponentLocationsSeparated(USceneComponent** SceneComponents, int32 Count, float* X, float* Y, float* Z) {
+			for (int32 i = 0; i < Count; i++) {
+				USceneComponent* sceneComponent = SceneComponents[i];
+
+				const FVector location = sceneComponent && !sceneComponent->IsPendingKill() ? sceneComponent->GetComponentLocation() : FVector::ZeroVector;
+
+				X[i] = location.X;
+				Y[i] = location.Y;
+				Z[i] = location.Z;
+			}
+		}
+
+		void SetWorldTransforms(USceneComponent** SceneComponents, int32 Count, const Transform* Transforms, bool Teleport) {
+			const ETeleportType teleport = Teleport ? ETeleportType::TeleportPhysics : ETeleportType::None;
+
+			UnrealCLR::Utility::MoveComponents(SceneComponents, Count, [Transforms, teleport](USceneComponent* SceneComponent, int32 Index) {
+				SceneComponent->SetWorldTransform(Transforms[Index], false, nullptr, teleport);
+			});
+		}
+
+		void SetWorldLocations(USceneComponent** SceneComponents, int32 Count, const Vector3* Locations, bool Teleport) {
+			const ETeleportType teleport = Teleport ? ETeleportType::TeleportPhysics : ETeleportType::None;
+
+			UnrealCLR::Utility::MoveComponents(SceneComponents, Count, [Locations, teleport](USceneComponent* SceneComponent, int32 Index) {
+				SceneComponent->SetWorldLocation(Locations[Index], false, nullptr, teleport);
+			});
+		}
+
+		void SetRelativeTransforms(USceneComponent** SceneComponents, int32 Count, const Transform* Transforms, bool Teleport) {
+			const ETeleportType teleport = Teleport ? ETeleportType::TeleportPhysics : ETeleportType::None;
+
+			UnrealCLR::Utility::MoveComponents(SceneComponents, Count, [Transforms, teleport](USceneComponent* SceneComponent, int32 Index) {
+				SceneComponent->SetRelativeTransform(Transforms[Index], false, nullptr, teleport);
+			});
+		}
 	}
 
 	namespace AudioComponent {
@@ -3050,16 +3884,14 @@ namespace UnrealCLRFramework {
 		}
 
 		void ForEachOverlappingComponent(UPrimitiveComponent* PrimitiveComponent, UPrimitiveComponent** Array, int32* Elements) {
-			static TArray<UPrimitiveComponent*> overlappingComponents;
-
-			overlappingComponents.Reset();
+			TArray<UPrimitiveComponent*> overlappingComponents;
 
 			PrimitiveComponent->GetOverlappingComponents(overlappingComponents);
 
 			int32 elements = overlappingComponents.Num();
 
 			if (elements > 0) {
-				*Array = reinterpret_cast<UPrimitiveComponent*>(overlappingComponents.GetData());
+				*Array = reinterpret_cast<UPrimitiveComponent*>(UnrealCLR::Arena::Move(overlappingComponents));
 				*Elements = elements;
 			}
 		}
@@ -3339,12 +4171,18 @@ namespace UnrealCLRFramework {
 			return PrimitiveComponent->CreateAndSetMaterialInstanceDynamic(ElementIndex);
 		}
 
-		void RegisterEvent(UPrimitiveComponent* PrimitiveComponent, ComponentEventType Type) {
+		void RegisterEvent(UPrimitiveComponent* PrimitiveComponent, ComponentEventType Type, HitFilter Filter, float FilterValue) {
 			UNREALCLR_SET_COMPONENT_EVENT(Type, !, AddDynamic);
+
+			if (Type == ComponentEventType::OnComponentHit)
+				UnrealCLR::Coalescing::SetFilter(PrimitiveComponent, Filter, FilterValue);
 		}
 
 		void UnregisterEvent(UPrimitiveComponent* PrimitiveComponent, ComponentEventType Type) {
 			UNREALCLR_SET_COMPONENT_EVENT(Type, UNREALCLR_NONE, RemoveDynamic);
+
+			if (Type == ComponentEventType::OnComponentHit)
+				UnrealCLR::Coalescing::SetFilter(PrimitiveComponent, HitFilter::None, 0.0f);
 		}
 	}
 
@@ -23,61 +23,56 @@
 
 #include "UnrealCLRManager.h"
 
+void UUnrealCLRManager::ActorDestroyed(AActor* DestroyedActor) {
+	UnrealCLR::Lifetime::ActorDestroyed(DestroyedActor);
+}
+
 void UUnrealCLRManager::ActorBeginOverlap(AActor* OverlapActor, AActor* OtherActor) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorBeginOverlap]) {
-		void* parameters[2] = {
-			OverlapActor,
-			OtherActor
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnActorBeginOverlap], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ActorOverlapDelegate)));
+		if (UnrealCLR::Batching::IsEnabled())
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnActorBeginOverlap, OverlapActor, OtherActor);
+		else
+			reinterpret_cast<UnrealCLRFramework::ActorOverlapDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnActorBeginOverlap])(OverlapActor, OtherActor);
 	}
 }
 
 void UUnrealCLRManager::ActorEndOverlap(AActor* OverlapActor, AActor* OtherActor) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorEndOverlap]) {
-		void* parameters[2] = {
-			OverlapActor,
-			OtherActor
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnActorEndOverlap], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ActorOverlapDelegate)));
+		if (UnrealCLR::Batching::IsEnabled())
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnActorEndOverlap, OverlapActor, OtherActor);
+		else
+			reinterpret_cast<UnrealCLRFramework::ActorOverlapDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnActorEndOverlap])(OverlapActor, OtherActor);
 	}
 }
 
 void UUnrealCLRManager::ActorHit(AActor* HitActor, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit) {
-	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorHit]) {
-		UnrealCLRFramework::Vector3 normalImpulse(NormalImpulse);
-		UnrealCLRFramework::Hit hit(Hit);
-
-		void* parameters[4] = {
-			HitActor,
-			OtherActor,
-			&normalImpulse,
-			&hit
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnActorHit], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ActorHitDelegate)));
+	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorHit] && UnrealCLR::Coalescing::ShouldDispatch(HitActor, OtherActor, NormalImpulse)) {
+		if (UnrealCLR::Batching::IsEnabled()) {
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnActorHit, HitActor, OtherActor, NormalImpulse, Hit);
+		} else {
+			UnrealCLRFramework::Vector3 normalImpulse(NormalImpulse);
+			UnrealCLRFramework::Hit hit(Hit);
+
+			reinterpret_cast<UnrealCLRFramework::ActorHitDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnActorHit])(HitActor, OtherActor, &normalImpulse, &hit);
+		}
 	}
 }
 
 void UUnrealCLRManager::ActorBeginCursorOver(AActor* Actor) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorBeginCursorOver]) {
-		void* parameters[1] = {
-			Actor
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnActorBeginCursorOver], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ActorCursorDelegate)));
+		if (UnrealCLR::Batching::IsEnabled())
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnActorBeginCursorOver, Actor, nullptr);
+		else
+			reinterpret_cast<UnrealCLRFramework::ActorCursorDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnActorBeginCursorOver])(Actor);
 	}
 }
 
 void UUnrealCLRManager::ActorEndCursorOver(AActor* Actor) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorEndCursorOver]) {
-		void* parameters[1] = {
-			Actor
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnActorEndCursorOver], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ActorCursorDelegate)));
+		if (UnrealCLR::Batching::IsEnabled())
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnActorEndCursorOver, Actor, nullptr);
+		else
+			reinterpret_cast<UnrealCLRFramework::ActorCursorDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnActorEndCursorOver])(Actor);
 	}
 }
 
@@ -85,12 +80,7 @@ void UUnrealCLRManager::ActorClicked(AActor* Actor, FKey Key) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorClicked]) {
 		FString key = Key.ToString();
 
-		void* parameters[2] = {
-			Actor,
-			TCHAR_TO_ANSI(*key)
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnActorClicked], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ActorKeyDelegate)));
+		reinterpret_cast<UnrealCLRFramework::ActorKeyDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnActorClicked])(Actor, TCHAR_TO_ANSI(*key));
 	}
 }
 
@@ -98,70 +88,56 @@ void UUnrealCLRManager::ActorReleased(AActor* Actor, FKey Key) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorReleased]) {
 		FString key = Key.ToString();
 
-		void* parameters[2] = {
-			Actor,
-			TCHAR_TO_ANSI(*key)
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnActorReleased], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ActorKeyDelegate)));
+		reinterpret_cast<UnrealCLRFramework::ActorKeyDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnActorReleased])(Actor, TCHAR_TO_ANSI(*key));
 	}
 }
 
 void UUnrealCLRManager::ComponentBeginOverlap(UPrimitiveComponent* OverlapComponent, AActor* OtherActor, UPrimitiveComponent* OtherComponent, int32 OtherBodyIndex, bool FromSweep, const FHitResult& SweepResult) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnComponentBeginOverlap]) {
-		void* parameters[2] = {
-			OverlapComponent,
-			OtherComponent
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnComponentBeginOverlap], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ComponentOverlapDelegate)));
+		if (UnrealCLR::Batching::IsEnabled())
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnComponentBeginOverlap, OverlapComponent, OtherComponent);
+		else
+			reinterpret_cast<UnrealCLRFramework::ComponentOverlapDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnComponentBeginOverlap])(OverlapComponent, OtherComponent);
 	}
 }
 
 void UUnrealCLRManager::ComponentEndOverlap(UPrimitiveComponent* OverlapComponent, AActor* OtherActor, UPrimitiveComponent* OtherComponent, int32 OtherBodyIndex) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnComponentEndOverlap]) {
-		void* parameters[2] = {
-			OverlapComponent,
-			OtherComponent
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnComponentEndOverlap], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ComponentOverlapDelegate)));
+		if (UnrealCLR::Batching::IsEnabled())
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnComponentEndOverlap, OverlapComponent, OtherComponent);
+		else
+			reinterpret_cast<UnrealCLRFramework::ComponentOverlapDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnComponentEndOverlap])(OverlapComponent, OtherComponent);
 	}
 }
 
 void UUnrealCLRManager::ComponentHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComponent, FVector NormalImpulse, const FHitResult& Hit) {
-	if (UnrealCLR::Shared::Events[UnrealCLR::OnComponentHit]) {
-		UnrealCLRFramework::Vector3 normalImpulse(NormalImpulse);
-		UnrealCLRFramework::Hit hit(Hit);
-
-		void* parameters[4] = {
-			HitComponent,
-			OtherComponent,
-			&normalImpulse,
-			&hit
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnComponentHit], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ComponentHitDelegate)));
+	if (UnrealCLR::Shared::Events[UnrealCLR::OnComponentHit] && UnrealCLR::Coalescing::ShouldDispatch(HitComponent, OtherComponent, NormalImpulse)) {
+		if (UnrealCLR::Batching::IsEnabled()) {
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnComponentHit, HitComponent, OtherComponent, NormalImpulse, Hit);
+		} else {
+			UnrealCLRFramework::Vector3 normalImpulse(NormalImpulse);
+			UnrealCLRFramework::Hit hit(Hit);
+
+			reinterpret_cast<UnrealCLRFramework::ComponentHitDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnComponentHit])(HitComponent, OtherComponent, &normalImpulse, &hit);
+		}
 	}
 }
 
 void UUnrealCLRManager::ComponentBeginCursorOver(UPrimitiveComponent* Component) {
-	if (UnrealCLR::Shared::Events[UnrealCLR::OnActorBeginCursorOver]) {
-		void* parameters[1] = {
-			Component
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnComponentBeginCursorOver], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ComponentCursorDelegate)));
+	if (UnrealCLR::Shared::Events[UnrealCLR::OnComponentBeginCursorOver]) {
+		if (UnrealCLR::Batching::IsEnabled())
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnComponentBeginCursorOver, Component, nullptr);
+		else
+			reinterpret_cast<UnrealCLRFramework::ComponentCursorDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnComponentBeginCursorOver])(Component);
 	}
 }
 
 void UUnrealCLRManager::ComponentEndCursorOver(UPrimitiveComponent* Component) {
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnComponentEndCursorOver]) {
-		void* parameters[1] = {
-			Component
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnComponentEndCursorOver], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ComponentCursorDelegate)));
+		if (UnrealCLR::Batching::IsEnabled())
+			UnrealCLR::Batching::Enqueue(UnrealCLR::OnComponentEndCursorOver, Component, nullptr);
+		else
+			reinterpret_cast<UnrealCLRFramework::ComponentCursorDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnComponentEndCursorOver])(Component);
 	}
 }
 
@@ -169,12 +145,7 @@ void UUnrealCLRManager::ComponentClicked(UPrimitiveComponent* Component, FKey Ke
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnComponentClicked]) {
 		FString key = Key.ToString();
 
-		void* parameters[2] = {
-			Component,
-			TCHAR_TO_ANSI(*key)
-		};
-
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnComponentClicked], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ComponentKeyDelegate)));
+		reinterpret_cast<UnrealCLRFramework::ComponentKeyDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnComponentClicked])(Component, TCHAR_TO_ANSI(*key));
 	}
 }
 
@@ -182,11 +153,91 @@ void UUnrealCLRManager::ComponentReleased(UPrimitiveComponent* Component, FKey K
 	if (UnrealCLR::Shared::Events[UnrealCLR::OnComponentReleased]) {
 		FString key = Key.ToString();
 
-		void* parameters[2] = {
-			Component,
-			TCHAR_TO_ANSI(*key)
-		};
+		reinterpret_cast<UnrealCLRFramework::ComponentKeyDelegate>(UnrealCLR::Shared::Events[UnrealCLR::OnComponentReleased])(Component, TCHAR_TO_ANSI(*key));
+	}
+}
+
+UActorComponent* UUnrealCLRManager::FindComponent(AActor* Actor, FName Name, UClass* Type) {
+	for (int32 attempt = 0; attempt < 2; attempt++) {
+		const TWeakObjectPtr<UActorComponent>* entry = GetComponentIndex(Actor, attempt > 0).Names.Find(Name);
+
+		// Rebuild the index once on a miss or if the component was renamed or destroyed since it was indexed, renames outside of the framework keep the amount of components
+		if (!entry)
+			continue;
 
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[UnrealCLR::OnComponentReleased], UnrealCLR::Callback(parameters, UnrealCLR::CallbackType::ComponentKeyDelegate)));
+		UActorComponent* component = entry->Get();
+
+		if (component && component->GetFName() == Name && component->GetOwner() == Actor)
+			return component->IsA(Type) ? component : nullptr;
 	}
+
+	return nullptr;
+}
+
+UActorComponent* UUnrealCLRManager::FindComponentByTag(AActor* Actor, FName Tag, UClass* Type) {
+	for (int32 attempt = 0; attempt < 2; attempt++) {
+		const TArray<TWeakObjectPtr<UActorComponent>>* entries = GetComponentIndex(Actor, attempt > 0).Tags.Find(Tag);
+
+		// Rebuild the index once on a miss since tags can be added to components outside of the framework
+		if (!entries)
+			continue;
+
+		// Components are stored in the order of the actor's components to return the same component as a linear search
+		for (const TWeakObjectPtr<UActorComponent>& entry : *entries) {
+			UActorComponent* component = entry.Get();
+
+			if (component && component->GetOwner() == Actor && component->ComponentHasTag(Tag) && component->IsA(Type))
+				return component;
+		}
+	}
+
+	return nullptr;
+}
+
+UActorComponent* UUnrealCLRManager::FindComponentByID(AActor* Actor, uint32 ID, UClass* Type) {
+	for (int32 attempt = 0; attempt < 2; attempt++) {
+		const TWeakObjectPtr<UActorComponent>* entry = GetComponentIndex(Actor, attempt > 0).IDs.Find(ID);
+
+		if (!entry)
+			continue;
+
+		UActorComponent* component = entry->Get();
+
+		if (component && component->GetOwner() == Actor)
+			return component->IsA(Type) ? component : nullptr;
+	}
+
+	return nullptr;
+}
+
+void UUnrealCLRManager::InvalidateComponents(const AActor* Actor) {
+	ComponentIndices.Remove(Actor);
+}
+
+FUnrealCLRComponentIndex& UUnrealCLRManager::GetComponentIndex(AActor* Actor, bool Rebuild) {
+	FUnrealCLRComponentIndex& index = ComponentIndices.FindOrAdd(Actor);
+	const auto& components = Actor->GetComponents();
+
+	// Components added or removed outside of the framework change the amount of owned components
+	if (Rebuild || index.Components != components.Num()) {
+		index.Names.Reset();
+		index.Tags.Reset();
+		index.IDs.Reset();
+
+		for (UActorComponent* component : components) {
+			if (!component)
+				continue;
+
+			index.Names.Add(component->GetFName(), component);
+			index.IDs.Add(component->GetUniqueID(), component);
+
+			for (const FName& tag : component->ComponentTags) {
+				index.Tags.FindOrAdd(tag).Add(component);
+			}
+		}
+
+		index.Components = components.Num();
+	}
+
+	return index;
 }
\ No newline at end of file
@@ -31,6 +31,7 @@
 #include "AIController.h"
 #include "Animation/AnimInstance.h"
 #include "AssetRegistryModule.h"
+#include "Async/Async.h"
 #include "Camera/CameraActor.h"
 #include "Camera/CameraComponent.h"
 #include "Components/AudioComponent.h"
@@ -74,6 +75,7 @@
 #include "ImageUtils.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Misc/DefaultValueHelper.h"
+#include "Misc/FileHelper.h"
 #include "Misc/OutputDeviceNull.h"
 #include "Modules/ModuleManager.h"
 #include "MotionControllerComponent.h"
@@ -103,8 +105,41 @@
 #define UNREALCLR_BRACKET_LEFT (
 #define UNREALCLR_BRACKET_RIGHT )
 
+#ifndef UNREALCLR_PROFILER
+	#define UNREALCLR_PROFILER 0
+#endif
+
+#ifndef UNREALCLR_THREAD_CHECKS
+	#define UNREALCLR_THREAD_CHECKS (UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT)
+#endif
+
+#if UNREALCLR_THREAD_CHECKS
+	#define UNREALCLR_GAME_THREAD_FUNCTION(Function) UnrealCLR::Threading::Thunk<decltype(&Function), &Function>::Invoke
+	#define UNREALCLR_GAME_THREAD_FUNCTION_NAME(Function) UnrealCLR::Threading::Thunk<decltype(&Function), &Function>::Name = TEXT(#Function)
+#else
+	#define UNREALCLR_GAME_THREAD_FUNCTION(Function) Function
+	#define UNREALCLR_GAME_THREAD_FUNCTION_NAME(Function) (void)0
+#endif
+
+#if UNREALCLR_PROFILER
+	#define UNREALCLR_PROFILED_FUNCTION(Function, Name) UnrealCLR::Profiler::Register<decltype(&Function), &Function>(TEXT(Name))
+	#define UNREALCLR_PROFILER_TICK_GROUP(TickGroup) const UnrealCLR::Profiler::TickGroupScope tickGroupScope(TickGroup)
+#else
+	#define UNREALCLR_PROFILED_FUNCTION(Function, Name) (void*)&Function
+	#define UNREALCLR_PROFILER_TICK_GROUP(TickGroup)
+#endif
+
+#define UNREALCLR_FUNCTION(Function) (UNREALCLR_GAME_THREAD_FUNCTION_NAME(Function), UNREALCLR_PROFILED_FUNCTION(UNREALCLR_GAME_THREAD_FUNCTION(Function), #Function))
+#define UNREALCLR_THREADSAFE_FUNCTION(Function) UNREALCLR_PROFILED_FUNCTION(Function, #Function)
+
 UNREALCLR_API DECLARE_LOG_CATEGORY_EXTERN(LogUnrealCLR, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("UnrealCLR"), STATGROUP_UnrealCLR, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Actors"), STAT_UnrealCLRPooledActors, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Hits"), STAT_UnrealCLRPoolHits, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Misses"), STAT_UnrealCLRPoolMisses, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Releases"), STAT_UnrealCLRPoolReleases, STATGROUP_UnrealCLR);
+
 namespace UnrealCLR {
 	enum struct StatusType : int32 {
 		Stopped,
@@ -174,9 +209,18 @@ namespace UnrealCLR {
 		OnComponentBeginCursorOver,
 		OnComponentEndCursorOver,
 		OnComponentClicked,
-		OnComponentReleased
+		OnComponentReleased,
+		OnEventsBatch,
+		OnWorldFixedTick,
+		OnAsyncQueries
 	};
 
+	typedef void (*WorldDelegate)();
+
+	typedef void (*WorldTickDelegate)(float DeltaTime);
+
+	typedef void (*WorldFixedTickDelegate)(float StepTime, int32 Substeps, float Alpha);
+
 	struct Callback {
 		void** Parameters;
 		CallbackType Type;
@@ -295,6 +339,19 @@ namespace UnrealCLR {
 		virtual FString DiagnosticMessage() override;
 	};
 
+	struct FrameEndTickFunction : public FTickFunction {
+		virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+		virtual FString DiagnosticMessage() override;
+	};
+
+	struct CustomTickFunction : public FTickFunction {
+		UnrealCLRFramework::TickDelegate Callback = nullptr;
+		int32 Generation = 1;
+
+		virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+		virtual FString DiagnosticMessage() override;
+	};
+
 	class Module : public IModuleInterface {
 		protected:
 
@@ -318,6 +375,7 @@ namespace UnrealCLR {
 		DuringPhysicsTickFunction OnDuringPhysicsTickFunction;
 		PostPhysicsTickFunction OnPostPhysicsTickFunction;
 		PostUpdateTickFunction OnPostUpdateTickFunction;
+		FrameEndTickFunction OnFrameEndTickFunction;
 
 		void* HostfxrLibrary;
 	};
@@ -340,6 +398,12 @@ namespace UnrealCLR {
 		static void* ConsoleManagerFunctions[storageSize];
 		static void* EngineFunctions[storageSize];
 		static void* WorldFunctions[storageSize];
+		static void* JobsFunctions[storageSize];
+		static void* SpatialHashFunctions[storageSize];
+		static void* HandlesFunctions[storageSize];
+		static void* MirrorFunctions[storageSize];
+		static void* ActorPoolFunctions[storageSize];
+		static void* CollisionQueryFunctions[storageSize];
 
 		// Instantiable
 
@@ -402,8 +466,473 @@ namespace UnrealCLR {
 		static void* Functions[128];
 	}
 
+	namespace Batching {
+		struct Buffer {
+			TArray<int32> Types;
+			TArray<TWeakObjectPtr<UObject>> FirstObjects;
+			TArray<TWeakObjectPtr<UObject>> SecondObjects;
+			TArray<int32> HitIndices;
+			TArray<UnrealCLRFramework::Vector3> NormalImpulses;
+			TArray<UnrealCLRFramework::Hit> Hits;
+			TArray<TWeakObjectPtr<AActor>> HitActors;
+			TArray<void*> FirstPointers;
+			TArray<void*> SecondPointers;
+		};
+
+		static Buffer Buffers[2];
+		static int32 Current = 0;
+		static bool Dispatching = false;
+
+		FORCEINLINE static bool IsEnabled();
+		FORCEINLINE static void Enqueue(int32 Event, UObject* FirstObject, UObject* SecondObject);
+		FORCEINLINE static void Enqueue(int32 Event, UObject* FirstObject, UObject* SecondObject, const FVector& NormalImpulse, const FHitResult& Hit);
+		static void Deliver(int32 Event, void* FirstObject, void* SecondObject, const UnrealCLRFramework::Vector3* NormalImpulse, const UnrealCLRFramework::Hit* Hit);
+		static void Dispatch();
+		static void Reset();
+	}
+
+	namespace Coalescing {
+		struct Filter {
+			UnrealCLRFramework::HitFilter Type;
+			float Value;
+		};
+
+		struct Contact {
+			uint64 Frame;
+			float Time;
+		};
+
+		static TMap<TWeakObjectPtr<const UObject>, Filter> Filters;
+		static TMap<TPair<const UObject*, const UObject*>, Contact> Contacts;
+
+		static void SetFilter(const UObject* Object, UnrealCLRFramework::HitFilter Type, float Value);
+		static bool ShouldDispatch(const UObject* Object, const UObject* OtherObject, const FVector& NormalImpulse);
+		static void Prune();
+		static void Reset();
+	}
+
+	namespace Threading {
+		static FTickFunction* TickFunctions[TG_MAX];
+
+		static bool SetRunOnAnyThread(ETickingGroup TickGroup, bool Value);
+		static void Reset();
+
+		#if UNREALCLR_THREAD_CHECKS
+			template <typename Type, Type Function>
+			struct Thunk;
+
+			template <typename Result, typename... Arguments, Result (*Function)(Arguments...)>
+			struct Thunk<Result (*)(Arguments...), Function> {
+				static const TCHAR* Name;
+
+				static Result Invoke(Arguments... Values) {
+					ensureMsgf(IsInGameThread(), TEXT("%s: Function is not safe to call outside of the game thread"), Name);
+
+					return Function(Values...);
+				}
+			};
+
+			template <typename Result, typename... Arguments, Result (*Function)(Arguments...)>
+			const TCHAR* Thunk<Result (*)(Arguments...), Function>::Name = TEXT("Unknown");
+		#endif
+	}
+
+	namespace FixedTick {
+		static float StepTime = 0.0f;
+		static int32 MaxSubsteps = 0;
+		static float Accumulator = 0.0f;
+
+		static void Set(float Step, int32 Substeps);
+		static void Advance(float DeltaTime);
+		static void Reset();
+	}
+
+	namespace Ticking {
+		static constexpr int32 slotBits = 16;
+		static constexpr int32 slotMask = (1 << slotBits) - 1;
+		static constexpr int32 generationMask = 0x7FFF;
+
+		static TArray<TUniquePtr<CustomTickFunction>> TickFunctions;
+
+		static int32 Register(UnrealCLRFramework::TickDelegate Callback, ETickingGroup TickGroup, float TickInterval, bool TickEvenWhenPaused);
+		static bool Unregister(int32 Handle);
+		static CustomTickFunction* Find(int32 Handle);
+		static void Reset();
+	}
+
+	namespace Jobs {
+		static FCriticalSection Lock;
+		static TMap<int32, FGraphEventRef> Handles;
+		static TMap<int32, FGraphEventRef> Released;
+		static int32 NextHandle = 0;
+
+		static int32 Add(const FGraphEventRef& Event);
+		static FGraphEventRef Find(int32 Handle);
+		static bool Gather(const int32* Prerequisites, int32 Count, FGraphEventArray& Events);
+		static void Remove(int32 Handle);
+		static void Reset();
+	}
+
+	namespace Lifetime {
+		static void ActorDestroyed(AActor* Actor);
+	}
+
+	namespace Indexing {
+		static TMultiMap<FName, TWeakObjectPtr<AActor>> Names;
+		static TMultiMap<FName, TWeakObjectPtr<AActor>> Tags;
+		static TMap<uint32, TWeakObjectPtr<AActor>> IDs;
+		static FDelegateHandle OnActorSpawnedHandle;
+		static FDelegateHandle OnLevelAddedHandle;
+		static FDelegateHandle OnLevelRemovedHandle;
+
+		#if ENGINE_MAJOR_VERSION == 5
+			static FDelegateHandle OnActorDestroyedHandle;
+		#endif
+
+		static void Initialize(UWorld* World);
+		static void Add(AActor* Actor);
+		static void Unlink(AActor* Actor);
+		static void AddTag(AActor* Actor, FName Tag);
+		static void RemoveTag(AActor* Actor, FName Tag);
+		static bool Rename(AActor* Actor, const TCHAR* Name);
+		static void OnLevelAdded(ULevel* Level, UWorld* World);
+		static void OnLevelRemoved(ULevel* Level, UWorld* World);
+		static AActor* FindByName(FName Name, UClass* Type);
+		static bool IndexTag(FName Tag);
+		static AActor* FindByTag(FName Tag, UClass* Type);
+		static void FindAllByTag(FName Tag, UClass* Type, TArray<AActor*>& Actors);
+		static AActor* FindByID(uint32 ID, UClass* Type);
+		static void Reset(UWorld* World);
+	}
+
+	namespace Arena {
+		struct Destructor {
+			void (*Function)(void* Objects, int32 Count);
+			void* Objects;
+			int32 Count;
+		};
+
+		static constexpr int32 chunkSize = 64 * 1024;
+
+		static TArray<TArray<uint8>> Chunks;
+		static TArray<Destructor> Destructors;
+		static int32 Offset = 0;
+		static int32 Used = 0;
+		static uint64 Frame = 0;
+
+		static void* Allocate(int32 Size, int32 Alignment);
+		static void BeginFrame();
+		static void Reset();
+
+		template <typename Type>
+		static Type* Allocate(int32 Count) {
+			return static_cast<Type*>(Allocate(Count * static_cast<int32>(sizeof(Type)), static_cast<int32>(alignof(Type))));
+		}
+
+		template <typename Type, typename AllocatorType>
+		static Type* Move(TArray<Type, AllocatorType>& Source) {
+			const int32 count = Source.Num();
+			Type* objects = Allocate<Type>(count);
+
+			MoveConstructItems<Type>(objects, Source.GetData(), count);
+
+			if (!TIsTriviallyDestructible<Type>::Value) {
+				Destructors.Add({ [](void* Objects, int32 Count) {
+					DestructItems(static_cast<Type*>(Objects), Count);
+				}, objects, count });
+			}
+
+			Source.Reset();
+
+			return objects;
+		}
+	}
+
+	namespace Handles {
+		static constexpr int32 chunkShift = 12;
+		static constexpr int32 chunkSize = 1 << chunkShift;
+		static constexpr int32 maxChunks = 1024;
+
+		// Shared with the managed side to validate handles without calling into the engine, chunks of generations are never moved or freed since other threads may read them at any time
+		struct Table {
+			uint32** Chunks;
+			int32 Length;
+		};
+
+		static uint32* Chunks[maxChunks];
+		static Table SharedTable = { Chunks, 0 };
+		static TArray<int32> FreeSlots;
+		static TMap<const AActor*, int32> Slots;
+
+		FORCEINLINE static uint32& GetGeneration(int32 Slot);
+		static uint64 Acquire(AActor* Actor);
+		static void Invalidate(const AActor* Actor);
+		static void Reset();
+	}
+
+	namespace Mirror {
+		static constexpr int32 minCapacity = 64;
+
+		// Shared with the managed side, the current buffer is not written until the next update
+		struct Table {
+			UnrealCLRFramework::ActorState* Buffers[2];
+			int32 Current;
+			int32 Length;
+		};
+
+		static Table SharedTable = { { nullptr, nullptr }, 0, 0 };
+		static TArray<UnrealCLRFramework::ActorState> Buffers[2];
+		static TArray<TArray<UnrealCLRFramework::ActorState>> Retired;
+		static TArray<TWeakObjectPtr<AActor>> Actors;
+		static TArray<int32> FreeSlots;
+		static TArray<int32> RemovedSlots;
+		static TMap<const AActor*, int32> Slots;
+
+		static int32 Add(AActor* Actor);
+		static bool Remove(const AActor* Actor);
+		static void Grow(int32 Capacity);
+		static void Update();
+		static void Reset();
+	}
+
+	namespace Pooling {
+		// Captured on release and restored on acquire
+		struct State {
+			TArray<TWeakObjectPtr<UActorComponent>> TickingComponents;
+			bool Hidden;
+			bool CollisionEnabled;
+			bool TickEnabled;
+			bool Hashed;
+			bool Mirrored;
+		};
+
+		static TMap<const UClass*, TArray<TWeakObjectPtr<AActor>>> Pools;
+		static TMap<const AActor*, State> Parked;
+
+		static AActor* Acquire(UClass* Type, const FTransform& Transform);
+		static bool Release(AActor* Actor);
+		static void Prewarm(UClass* Type, int32 Count);
+		static void Park(AActor* Actor);
+		static void Remove(const AActor* Actor);
+		static void Reset();
+	}
+
+	namespace Spawning {
+		static TMap<const AActor*, FTransform> Deferred;
+
+		static AActor* Begin(UClass* Type, const FTransform& Transform);
+		static bool Finish(AActor* Actor);
+		static void Remove(const AActor* Actor);
+		static void Reset();
+	}
+
+	namespace CollisionQueries {
+		struct Descriptor {
+			FCollisionQueryParams Params;
+			FCollisionObjectQueryParams ObjectParams;
+			FName Profile;
+			ECollisionChannel Channel;
+		};
+
+		static constexpr int32 slotBits = 16;
+		static constexpr int32 slotMask = (1 << slotBits) - 1;
+		static constexpr int32 generationMask = 0x7FFF;
+
+		static TSparseArray<Descriptor> Descriptors;
+		static TArray<int32> Generations;
+
+		static int32 Create(ECollisionChannel Channel, FName Profile, bool TraceComplex);
+		static bool Destroy(int32 Handle);
+		static Descriptor* Find(int32 Handle);
+		static void Invalidate(int32 Slot);
+		static void Reset();
+	}
+
+	namespace AsyncQueries {
+		static TArray<UnrealCLRFramework::AsyncQueryResult> Results;
+		static FTraceDelegate TraceDelegate;
+		static FOverlapDelegate OverlapDelegate;
+		static uint32 NextTicket = 0;
+
+		static uint32 Acquire();
+		static void TraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+		static void OverlapCompleted(const FTraceHandle& Handle, FOverlapDatum& Datum);
+		static void Dispatch();
+		static void Reset();
+	}
+
+	namespace SpatialHash {
+		struct Entry {
+			TWeakObjectPtr<AActor> Actor;
+			TWeakObjectPtr<USceneComponent> Component;
+			FDelegateHandle TransformUpdatedHandle;
+			FVector Location;
+			FIntVector Cell;
+		};
+
+		static float CellSize = 1000.0f;
+		static TArray<Entry> Entries;
+		static TArray<int32> FreeEntries;
+		static TMap<const AActor*, int32> Indices;
+		static TMap<FIntVector, TArray<int32>> Cells;
+
+		static FIntVector GetCell(const FVector& Location);
+		static void Insert(int32 Index);
+		static void Erase(int32 Index);
+		static void SetCellSize(float Size);
+		static bool Add(AActor* Actor);
+		static bool Remove(AActor* Actor);
+		static void Update(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 Index);
+		static int32 QueryRadius(const FVector& Center, float Radius, AActor** Actors, int32 Length);
+		static int32 QueryBox(const FVector& Min, const FVector& Max, AActor** Actors, int32 Length);
+		static int32 QueryKNearest(const FVector& Center, float MaxDistance, AActor** Actors, int32 Length);
+		static void Reset();
+
+		template <typename Visitor>
+		static void ForEachInCell(const FIntVector& Cell, Visitor Function) {
+			if (const TArray<int32>* cell = Cells.Find(Cell)) {
+				for (int32 index : *cell) {
+					AActor* actor = Entries[index].Actor.Get();
+
+					// Actors being destroyed are skipped in case the removal from the index has not happened yet
+					if (actor && !actor->IsPendingKillPending())
+						Function(Entries[index], actor);
+				}
+			}
+		}
+
+		template <typename Visitor>
+		static void ForEachInBox(const FVector& Min, const FVector& Max, Visitor Function) {
+			const FIntVector min = GetCell(Min);
+			const FIntVector max = GetCell(Max);
+			const int64 cells = static_cast<int64>(max.X - min.X + 1) * (max.Y - min.Y + 1) * (max.Z - min.Z + 1);
+
+			if (cells > Cells.Num()) {
+				for (const TPair<FIntVector, TArray<int32>>& cell : Cells) {
+					if (cell.Key.X >= min.X && cell.Key.X <= max.X && cell.Key.Y >= min.Y && cell.Key.Y <= max.Y && cell.Key.Z >= min.Z && cell.Key.Z <= max.Z)
+						ForEachInCell(cell.Key, Function);
+				}
+			} else {
+				for (int32 x = min.X; x <= max.X; x++) {
+					for (int32 y = min.Y; y <= max.Y; y++) {
+						for (int32 z = min.Z; z <= max.Z; z++) {
+							ForEachInCell(FIntVector(x, y, z), Function);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	#if UNREALCLR_PROFILER
+		namespace Profiler {
+			struct Entry {
+				const TCHAR* Name;
+				int64 Calls[TG_MAX + 1];
+				int64 Cycles[TG_MAX + 1];
+
+				FORCEINLINE Entry(const TCHAR* Name) : Name(Name), Calls(), Cycles() { }
+			};
+
+			static TArray<Entry> Entries;
+			static bool Enabled = false;
+			static uint64 FirstFrame = 0;
+			static uint64 LastFrame = 0;
+			static thread_local ETickingGroup CurrentTickGroup = TG_MAX;
+
+			struct CallScope {
+				int32 Index;
+				uint64 Start;
+
+				FORCEINLINE CallScope(int32 Index) : Index(Index), Start(Enabled ? FPlatformTime::Cycles64() : 0) { }
+
+				FORCEINLINE ~CallScope() {
+					if (Start) {
+						Entry& entry = Entries[Index];
+
+						FPlatformAtomics::InterlockedIncrement(&entry.Calls[CurrentTickGroup]);
+						FPlatformAtomics::InterlockedAdd(&entry.Cycles[CurrentTickGroup], static_cast<int64>(FPlatformTime::Cycles64() - Start));
+					}
+				}
+			};
+
+			struct TickGroupScope {
+				ETickingGroup PreviousTickGroup;
+
+				FORCEINLINE TickGroupScope(ETickingGroup TickGroup) : PreviousTickGroup(CurrentTickGroup) {
+					CurrentTickGroup = TickGroup;
+				}
+
+				FORCEINLINE ~TickGroupScope() {
+					CurrentTickGroup = PreviousTickGroup;
+				}
+			};
+
+			template <typename Type, Type Function>
+			struct Thunk;
+
+			template <typename Result, typename... Arguments, Result (*Function)(Arguments...)>
+			struct Thunk<Result (*)(Arguments...), Function> {
+				static int32 Index;
+
+				static Result Invoke(Arguments... Values) {
+					const CallScope callScope(Index);
+
+					return Function(Values...);
+				}
+			};
+
+			template <typename Result, typename... Arguments, Result (*Function)(Arguments...)>
+			int32 Thunk<Result (*)(Arguments...), Function>::Index = INDEX_NONE;
+
+			template <typename Type, Type Function>
+			FORCEINLINE static void* Register(const TCHAR* Name) {
+				Thunk<Type, Function>::Index = Entries.Emplace(Name);
+
+				return (void*)&Thunk<Type, Function>::Invoke;
+			}
+
+			static void Start(const TArray<FString>& Arguments);
+			static void Stop(const TArray<FString>& Arguments);
+			static void Dump(const TArray<FString>& Arguments);
+			static void RegisterCommands();
+			static void UnregisterCommands();
+		}
+	#endif
+
 	namespace Utility {
 		FORCEINLINE static size_t Strcpy(char* Destination, const char* Source, size_t Length);
 		FORCEINLINE static size_t Strlen(const char* Source);
+		static int32 CopyHits(const TArray<FHitResult>& Source, UnrealCLRFramework::Hit* Destination, int32 Length);
+		static int32 CopyOverlaps(const TArray<FOverlapResult>& Source, UPrimitiveComponent** Destination, int32 Length);
+		static int32 GetHitStride(UnrealCLRFramework::HitFields Fields);
+		static void PackHit(const FHitResult& Hit, UnrealCLRFramework::HitFields Fields, uint8* Buffer);
+		static int32 PackHits(const TArray<FHitResult>& Source, UnrealCLRFramework::HitFields Fields, uint8* Destination, int32 Length);
+
+		template <typename Function>
+		static void MoveComponents(USceneComponent** Components, int32 Count, Function Callback) {
+			if (Count <= 0)
+				return;
+
+			// The engine has no scope that spans unrelated components, so each component opens its own and its updates run once after the batch is moved, but separately from other components
+			// Scopes are allocated from the arena since deferred events may move components again once the scopes are completed
+			FScopedMovementUpdate* scopes = UnrealCLR::Arena::Allocate<FScopedMovementUpdate>(Count);
+			int32 scopesCount = 0;
+
+			for (int32 i = 0; i < Count; i++) {
+				USceneComponent* component = Components[i];
+
+				if (component && !component->IsPendingKill()) {
+					new (&scopes[scopesCount++]) FScopedMovementUpdate(component, EScopedUpdate::DeferredUpdates);
+
+					Callback(component, i);
+				}
+			}
+
+			// Scopes should be completed in the reverse order of creation
+			for (int32 i = scopesCount - 1; i >= 0; i--) {
+				scopes[i].~FScopedMovementUpdate();
+			}
+		}
 	}
 }
\ No newline at end of file
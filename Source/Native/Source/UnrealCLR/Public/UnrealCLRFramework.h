@@ -46,6 +46,7 @@ namespace UnrealCLRFramework {
 	using InputEvent = EInputEvent;
 	using NetMode = ENetMode;
 	using PixelFormat = EPixelFormat;
+	using QueryMobility = EQueryMobilityType;
 	using TeleportType = ETeleportType;
 	using VerticalTextAligment = EVerticalTextAligment;
 	using PlaneConstraintAxis = EPlaneConstraintAxisSetting;
@@ -105,6 +106,39 @@ namespace UnrealCLRFramework {
 		OnComponentReleased
 	};
 
+	enum struct HitFilter : int32 {
+		None,
+		FirstContact,
+		Rate,
+		Impulse
+	};
+
+	enum struct HitFields : int32 {
+		None = 0,
+		Actor = 1 << 0,
+		Component = 1 << 1,
+		Location = 1 << 2,
+		ImpactLocation = 1 << 3,
+		Normal = 1 << 4,
+		ImpactNormal = 1 << 5,
+		Time = 1 << 6,
+		Distance = 1 << 7,
+		PenetrationDepth = 1 << 8,
+		BoneIndex = 1 << 9,
+		Flags = 1 << 10
+	};
+
+	enum struct TickGroup : int32 {
+		PrePhysics,
+		StartPhysics,
+		DuringPhysics,
+		EndPhysics,
+		PostPhysics,
+		PostUpdateWork,
+		LastDemotable,
+		NewlySpawned
+	};
+
 	struct Color {
 		uint8 B;
 		uint8 G;
@@ -221,6 +255,23 @@ namespace UnrealCLRFramework {
 			StartPenetrating(Value.bStartPenetrating) { }
 	};
 
+	struct ActorState {
+		Vector3 Location;
+		Quaternion Rotation;
+		Vector3 Velocity;
+		bool Hidden;
+		bool Valid;
+	};
+
+	struct AsyncQueryResult {
+		uint32 Ticket;
+		Hit Result;
+
+		FORCEINLINE AsyncQueryResult(uint32 Ticket, const FHitResult& Value) :
+			Ticket(Ticket),
+			Result(Value) { }
+	};
+
 	typedef void (*InputDelegate)();
 
 	typedef void (*InputAxisDelegate)(float);
@@ -247,6 +298,14 @@ namespace UnrealCLRFramework {
 
 	typedef void (*CharacterLandedDelegate)(const Hit* Hit);
 
+	typedef void (*TickDelegate)(float DeltaTime);
+
+	typedef void (*JobDelegate)(void* State, int32 Begin, int32 End);
+
+	typedef void (*EventsBatchDelegate)(const int32* Types, void* const* FirstObjects, void* const* SecondObjects, const int32* HitIndices, const Vector3* NormalImpulses, const Hit* Hits, int32 Count);
+
+	typedef void (*AsyncQueriesDelegate)(const AsyncQueryResult* Results, int32 Count);
+
 	// Enumerable
 
 	enum struct ObjectType : int32 {
@@ -430,7 +489,7 @@ namespace UnrealCLRFramework {
 	}
 
 	namespace World {
-		static void ForEachActor(AActor** Array, int32* Elements);
+		static int32 GetActors(ActorType Type, int64* Cursor, AActor** Actors, int32 Length);
 		static int32 GetActorCount();
 		static float GetDeltaSeconds();
 		static float GetRealTimeSeconds();
@@ -440,6 +499,7 @@ namespace UnrealCLRFramework {
 		static void GetWorldOrigin(Vector3* Value);
 		static AActor* GetActor(const char* Name, ActorType Type);
 		static AActor* GetActorByTag(const char* Tag, ActorType Type);
+		static void GetActorsByTag(const char* Tag, ActorType Type, AActor** Array, int32* Elements);
 		static AActor* GetActorByID(uint32 ID, ActorType Type);
 		static APlayerController* GetFirstPlayerController();
 		static AGameModeBase* GetGameMode();
@@ -457,6 +517,14 @@ namespace UnrealCLRFramework {
 		static void SetOnComponentEndCursorOverCallback(ComponentCursorDelegate Callback);
 		static void SetOnComponentClickedCallback(ComponentKeyDelegate Callback);
 		static void SetOnComponentReleasedCallback(ComponentKeyDelegate Callback);
+		static void SetEventsBatching(EventsBatchDelegate Callback);
+		static bool SetRunOnAnyThread(TickGroup Group, bool Value);
+		static int32 RegisterTickFunction(TickDelegate Callback, TickGroup Group, float TickInterval, bool TickEvenWhenPaused);
+		static bool UnregisterTickFunction(int32 Handle);
+		static bool SetTickFunctionEnabled(int32 Handle, bool Value);
+		static bool AddTickPrerequisiteActor(int32 Handle, AActor* Actor);
+		static bool AddTickPrerequisiteComponent(int32 Handle, UActorComponent* Component);
+		static void SetFixedTick(float StepTime, int32 MaxSubsteps);
 		static void SetSimulatePhysics(bool Value);
 		static void SetGravity(float Value);
 		static bool SetWorldOrigin(const Vector3* Value);
@@ -473,6 +541,77 @@ namespace UnrealCLRFramework {
 		static bool OverlapAnyTestByProfile(const Vector3* Location, const Quaternion* Rotation, const char* ProfileName, const CollisionShape* Shape, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
 		static bool OverlapBlockingTestByChannel(const Vector3* Location, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
 		static bool OverlapBlockingTestByProfile(const Vector3* Location, const Quaternion* Rotation, const char* ProfileName, const CollisionShape* Shape, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static int32 LineTraceMultiByChannel(const Vector3* Start, const Vector3* End, CollisionChannel Channel, Hit* Hits, int32 Length, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static int32 LineTraceMultiByProfile(const Vector3* Start, const Vector3* End, const char* ProfileName, Hit* Hits, int32 Length, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static int32 SweepMultiByChannel(const Vector3* Start, const Vector3* End, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, Hit* Hits, int32 Length, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static int32 SweepMultiByProfile(const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const char* ProfileName, const CollisionShape* Shape, Hit* Hits, int32 Length, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static int32 OverlapMultiByChannel(const Vector3* Location, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, UPrimitiveComponent** Components, int32 Length, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static int32 OverlapMultiByProfile(const Vector3* Location, const Quaternion* Rotation, const char* ProfileName, const CollisionShape* Shape, UPrimitiveComponent** Components, int32 Length, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static int32 LineTraceBatchByChannel(const Vector3* Starts, const Vector3* Ends, int32 Count, CollisionChannel Channel, Hit* Hits, uint8* HitMask, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static int32 SweepBatchByChannel(const Vector3* Starts, const Vector3* Ends, const Quaternion* Rotations, int32 Count, CollisionChannel Channel, const CollisionShape* Shape, Hit* Hits, uint8* HitMask, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static void SetOnAsyncQueriesCallback(AsyncQueriesDelegate Callback);
+		static uint32 AsyncLineTraceByChannel(const Vector3* Start, const Vector3* End, CollisionChannel Channel, bool Multi, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static uint32 AsyncSweepByChannel(const Vector3* Start, const Vector3* End, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, bool Multi, bool TraceComplex, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+		static uint32 AsyncOverlapByChannel(const Vector3* Location, const Quaternion* Rotation, CollisionChannel Channel, const CollisionShape* Shape, AActor* IgnoredActor, UPrimitiveComponent* IgnoredComponent);
+	}
+
+	namespace Jobs {
+		static int32 Schedule(JobDelegate Callback, void* State, const int32* Prerequisites, int32 PrerequisitesCount);
+		static int32 ScheduleParallel(JobDelegate Callback, void* State, int32 Count, int32 BatchSize, const int32* Prerequisites, int32 PrerequisitesCount);
+		static bool IsCompleted(int32 Handle);
+		static void Wait(int32 Handle);
+		static void Release(int32 Handle);
+	}
+
+	namespace SpatialHash {
+		static void SetCellSize(float CellSize);
+		static bool Add(AActor* Actor);
+		static bool Remove(AActor* Actor);
+		static int32 QueryRadius(const Vector3* Center, float Radius, AActor** Actors, int32 Length);
+		static int32 QueryBox(const Vector3* Min, const Vector3* Max, AActor** Actors, int32 Length);
+		static int32 QueryKNearest(const Vector3* Center, float MaxDistance, AActor** Actors, int32 Length);
+	}
+
+	namespace Handles {
+		static void* GetTable();
+		static uint64 Acquire(AActor* Actor);
+	}
+
+	namespace Mirror {
+		static void* GetTable();
+		static int32 Add(AActor* Actor);
+		static bool Remove(AActor* Actor);
+	}
+
+	namespace ActorPool {
+		static UClass* GetClass(ActorType Type, UObject* Blueprint);
+		static AActor* Acquire(ActorType Type, UObject* Blueprint, const Transform* Transform);
+		static bool Release(AActor* Actor);
+		static void Prewarm(ActorType Type, UObject* Blueprint, int32 Count);
+	}
+
+	namespace CollisionQuery {
+		static int32 Create(CollisionChannel Channel, const char* ProfileName, bool TraceComplex);
+		static bool Destroy(int32 Handle);
+		static bool AddIgnoredActor(int32 Handle, AActor* Actor);
+		static bool AddIgnoredComponent(int32 Handle, UPrimitiveComponent* Component);
+		static bool ClearIgnored(int32 Handle);
+		static bool AddObjectType(int32 Handle, CollisionChannel ObjectType);
+		static bool SetMobility(int32 Handle, QueryMobility Mobility);
+		static bool SetTraceComplex(int32 Handle, bool Value);
+		static bool LineTraceTest(int32 Handle, const Vector3* Start, const Vector3* End);
+		static bool LineTraceSingle(int32 Handle, const Vector3* Start, const Vector3* End, Hit* Hit);
+		static int32 LineTraceMulti(int32 Handle, const Vector3* Start, const Vector3* End, Hit* Hits, int32 Length);
+		static int32 LineTraceBatch(int32 Handle, const Vector3* Starts, const Vector3* Ends, int32 Count, Hit* Hits, uint8* HitMask);
+		static bool SweepTest(int32 Handle, const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const CollisionShape* Shape);
+		static bool SweepSingle(int32 Handle, const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const CollisionShape* Shape, Hit* Hit);
+		static int32 SweepMulti(int32 Handle, const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const CollisionShape* Shape, Hit* Hits, int32 Length);
+		static bool OverlapAnyTest(int32 Handle, const Vector3* Location, const Quaternion* Rotation, const CollisionShape* Shape);
+		static int32 OverlapMulti(int32 Handle, const Vector3* Location, const Quaternion* Rotation, const CollisionShape* Shape, UPrimitiveComponent** Components, int32 Length);
+		static int32 LineTraceMultiCompact(int32 Handle, const Vector3* Start, const Vector3* End, HitFields Fields, uint8* Hits, int32 Length);
+		static int32 LineTraceBatchCompact(int32 Handle, const Vector3* Starts, const Vector3* Ends, int32 Count, HitFields Fields, uint8* Hits, uint8* HitMask);
+		static int32 SweepMultiCompact(int32 Handle, const Vector3* Start, const Vector3* End, const Quaternion* Rotation, const CollisionShape* Shape, HitFields Fields, uint8* Hits, int32 Length);
+		static int32 SweepBatchCompact(int32 Handle, const Vector3* Starts, const Vector3* Ends, const Quaternion* Rotations, int32 Count, const CollisionShape* Shape, HitFields Fields, uint8* Hits, uint8* HitMask);
 	}
 
 	// Instantiable
@@ -523,6 +662,10 @@ namespace UnrealCLRFramework {
 		static void ForEachChildActor(AActor* Actor, AActor** Array, int32* Elements);
 		static void ForEachOverlappingActor(AActor* Actor, AActor** Array, int32* Elements);
 		static AActor* Spawn(const char* Name, ActorType Type, UObject* Blueprint);
+		static AActor* SpawnDeferred(const char* Name, ActorType Type, UObject* Blueprint, const Transform* Transform);
+		static bool FinishSpawning(AActor* Actor);
+		static int32 SpawnBatch(ActorType Type, UObject* Blueprint, const Transform* Transforms, int32 Count, bool Deferred, AActor** Actors);
+		static int32 FinishSpawningBatch(AActor** Actors, int32 Count);
 		static bool Destroy(AActor* Actor);
 		static void Rename(AActor* Actor, const char* Name);
 		static void Hide(AActor* Actor, bool Value);
@@ -547,7 +690,7 @@ namespace UnrealCLRFramework {
 		static void AddTag(AActor* Actor, const char* Tag);
 		static void RemoveTag(AActor* Actor, const char* Tag);
 		static bool HasTag(AActor* Actor, const char* Tag);
-		static void RegisterEvent(AActor* Actor, ActorEventType Type);
+		static void RegisterEvent(AActor* Actor, ActorEventType Type, HitFilter Filter, float FilterValue);
 		static void UnregisterEvent(AActor* Actor, ActorEventType Type);
 	}
 
@@ -878,6 +1021,12 @@ namespace UnrealCLRFramework {
 		static void SetWorldRotation(USceneComponent* SceneComponent, const Quaternion* Rotation);
 		static void SetWorldScale(USceneComponent* SceneComponent, const Vector3* Scale);
 		static void SetWorldTransform(USceneComponent* SceneComponent, const Transform* Transform);
+		static void GetComponentTransforms(USceneComponent** SceneComponents, int32 Count, Transform* Values);
+		static void GetComponentLocations(USceneComponent** SceneComponents, int32 Count, Vector3* Values);
+		static void GetComponentLocationsSeparated(USceneComponent** SceneComponents, int32 Count, float* X, float* Y, float* Z);
+		static void SetWorldTransforms(USceneComponent** SceneComponents, int32 Count, const Transform* Transforms, bool Teleport);
+		static void SetWorldLocations(USceneComponent** SceneComponents, int32 Count, const Vector3* Locations, bool Teleport);
+		static void SetRelativeTransforms(USceneComponent** SceneComponents, int32 Count, const Transform* Transforms, bool Teleport);
 	}
 
 	namespace AudioComponent {
@@ -1029,7 +1178,7 @@ namespace UnrealCLRFramework {
 		static void ClearMoveIgnoreActors(UPrimitiveComponent* PrimitiveComponent);
 		static void ClearMoveIgnoreComponents(UPrimitiveComponent* PrimitiveComponent);
 		static UMaterialInstanceDynamic* CreateAndSetMaterialInstanceDynamic(UPrimitiveComponent* PrimitiveComponent, int32 ElementIndex);
-		static void RegisterEvent(UPrimitiveComponent* PrimitiveComponent, ComponentEventType Type);
+		static void RegisterEvent(UPrimitiveComponent* PrimitiveComponent, ComponentEventType Type, HitFilter Filter, float FilterValue);
 		static void UnregisterEvent(UPrimitiveComponent* PrimitiveComponent, ComponentEventType Type);
 	}
 
@@ -24,15 +24,26 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
 #include "GameFramework/Actor.h"
 #include "UnrealCLRManager.generated.h"
 
+struct FUnrealCLRComponentIndex {
+	TMap<FName, TWeakObjectPtr<UActorComponent>> Names;
+	TMap<FName, TArray<TWeakObjectPtr<UActorComponent>>> Tags;
+	TMap<uint32, TWeakObjectPtr<UActorComponent>> IDs;
+	int32 Components = INDEX_NONE;
+};
+
 UCLASS()
 class UNREALCLR_API UUnrealCLRManager : public UObject {
 	GENERATED_BODY()
 
 	public:
 
+	UFUNCTION()
+	void ActorDestroyed(AActor* DestroyedActor);
+
 	UFUNCTION()
 	void ActorBeginOverlap(AActor* OverlapActor, AActor* OtherActor);
 
@@ -74,4 +85,18 @@ class UNREALCLR_API UUnrealCLRManager : public UObject {
 
 	UFUNCTION()
 	void ComponentReleased(UPrimitiveComponent* Component, FKey Key);
+
+	UActorComponent* FindComponent(AActor* Actor, FName Name, UClass* Type);
+
+	UActorComponent* FindComponentByTag(AActor* Actor, FName Tag, UClass* Type);
+
+	UActorComponent* FindComponentByID(AActor* Actor, uint32 ID, UClass* Type);
+
+	void InvalidateComponents(const AActor* Actor);
+
+	private:
+
+	FUnrealCLRComponentIndex& GetComponentIndex(AActor* Actor, bool Rebuild = false);
+
+	TMap<TWeakObjectPtr<const AActor>, FUnrealCLRComponentIndex> ComponentIndices;
 };
\ No newline at end of file
@@ -55,6 +55,11 @@ public class UnrealCLR : ModuleRules {
 
 		DynamicallyLoadedModuleNames.AddRange(new string[] { });
 
+		// Set UNREALCLR_PROFILER=1 in the environment to build with instrumented interop functions
+
+		if (Environment.GetEnvironmentVariable("UNREALCLR_PROFILER") == "1" && Target.Configuration != UnrealTargetConfiguration.Shipping)
+			PublicDefinitions.Add("UNREALCLR_PROFILER=1");
+
 		if (Target.bBuildEditor) {
 			PrivateDependencyModuleNames.AddRange(new string[] {
 				"UnrealEd"